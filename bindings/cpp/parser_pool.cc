@@ -0,0 +1,87 @@
+#include "parser_pool.h"
+#include "scanner_pool.h"
+
+#include <algorithm>
+#include <atomic>
+#include <thread>
+
+namespace blade {
+
+ParserPool::ParserPool(const TSLanguage *language, unsigned max_idle)
+  : language_(language), max_idle_(max_idle) {
+  if (max_idle_ == 0) max_idle_ = std::max(1u, std::thread::hardware_concurrency());
+  idle_.reserve(max_idle_);
+}
+
+ParserPool::~ParserPool() {
+  for (TSParser *parser : idle_) ts_parser_delete(parser);
+}
+
+ParserPool::Lease &ParserPool::Lease::operator=(Lease &&other) noexcept {
+  if (this != &other) {
+    if (parser_) pool_->checkin(parser_);
+    pool_ = other.pool_;
+    parser_ = other.parser_;
+    other.parser_ = nullptr;
+  }
+  return *this;
+}
+
+TSParser *ParserPool::acquire() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!idle_.empty()) {
+      TSParser *parser = idle_.back();
+      idle_.pop_back();
+      return parser;
+    }
+  }
+  TSParser *parser = ts_parser_new();
+  ts_parser_set_language(parser, language_);
+  return parser;
+}
+
+void ParserPool::checkin(TSParser *parser) {
+  ts_parser_reset(parser);
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (idle_.size() < max_idle_) {
+      idle_.push_back(parser);
+      return;
+    }
+  }
+  ts_parser_delete(parser);
+}
+
+std::vector<Tree> ParserPool::parse_all(std::span<const Source> sources) {
+  std::vector<Tree> trees(sources.size());
+  if (sources.empty()) return trees;
+  std::atomic<size_t> next(0);
+
+  // Sources are handed out one at a time, so a few large documents do not
+  // hold up the others.
+  auto work = [&] {
+    Lease lease = checkout();
+    for (size_t i; (i = next.fetch_add(1, std::memory_order_relaxed)) < sources.size();) {
+      const std::string_view &text = sources[i].text;
+      trees[i].reset(ts_parser_parse_string(lease.get(), nullptr, text.data(), text.size()));
+    }
+  };
+
+  size_t thread_count = std::min<size_t>(max_idle_, sources.size());
+  std::vector<std::thread> threads;
+  for (size_t i = 1; i < thread_count; i++) {
+    threads.emplace_back([&] {
+      work();
+      // Parsers that did not fit back into the pool were deleted on this
+      // thread. If the scanner was built with its own pool, their scanners
+      // went to this thread's one.
+      tree_sitter_blade_scanner_pool_clear();
+    });
+  }
+  work();
+  for (std::thread &thread : threads) thread.join();
+  return trees;
+}
+
+}  // namespace blade
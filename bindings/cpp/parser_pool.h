@@ -0,0 +1,101 @@
+#ifndef TREE_SITTER_BLADE_PARSER_POOL_H_
+#define TREE_SITTER_BLADE_PARSER_POOL_H_
+
+#include <tree_sitter/api.h>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <string_view>
+#include <vector>
+
+extern "C" const TSLanguage *tree_sitter_blade(void);
+
+namespace blade {
+
+struct TreeDeleter {
+  void operator()(TSTree *tree) const { ts_tree_delete(tree); }
+};
+
+// A parse result. Null if the parse failed, which only happens when the
+// language does not match the linked runtime.
+using Tree = std::unique_ptr<TSTree, TreeDeleter>;
+
+struct Source {
+  std::string_view text;
+};
+
+// A thread-safe set of parsers for one language, for hosts that parse from
+// many threads and do not want to pay for a parser (and its scanner) per
+// document.
+//
+//   blade::ParserPool pool;
+//   {
+//     ParserPool::Lease lease = pool.checkout();
+//     TSTree *tree = ts_parser_parse_string(lease.get(), NULL, text, length);
+//     ...
+//   }
+//   std::vector<Tree> trees = pool.parse_all(sources);
+//
+// Parsers are created on demand and reset with `ts_parser_reset` when they
+// come back, so a checked-out parser never carries state from an earlier,
+// possibly cancelled, parse. Settings made on a checked-out parser (logger,
+// timeout, cancellation flag, included ranges) are not undone; put those back
+// before returning it.
+class ParserPool {
+ public:
+  // Keeps up to `max_idle` parsers between uses; 0 means one per hardware
+  // thread. `parse_all` uses as many threads.
+  explicit ParserPool(const TSLanguage *language = tree_sitter_blade(), unsigned max_idle = 0);
+  ~ParserPool();
+
+  ParserPool(const ParserPool &) = delete;
+  ParserPool &operator=(const ParserPool &) = delete;
+
+  // A checked-out parser, returned to the pool when the lease goes away.
+  class Lease {
+   public:
+    Lease(Lease &&other) noexcept : pool_(other.pool_), parser_(other.parser_) {
+      other.parser_ = nullptr;
+    }
+    Lease &operator=(Lease &&other) noexcept;
+    Lease(const Lease &) = delete;
+    Lease &operator=(const Lease &) = delete;
+    ~Lease() { if (parser_) pool_->checkin(parser_); }
+
+    TSParser *get() const { return parser_; }
+
+   private:
+    friend class ParserPool;
+    Lease(ParserPool *pool, TSParser *parser) : pool_(pool), parser_(parser) {}
+
+    ParserPool *pool_;
+    TSParser *parser_;
+  };
+
+  Lease checkout() { return Lease(this, acquire()); }
+
+  // The same without the lease. Every parser from `acquire` has to be given
+  // back to `release` on this pool.
+  TSParser *acquire();
+  void release(TSParser *parser) { checkin(parser); }
+
+  // Parses every source, spreading them over up to `max_idle` threads
+  // (including the calling one), and returns the trees in the order of
+  // `sources`.
+  std::vector<Tree> parse_all(std::span<const Source> sources);
+
+  const TSLanguage *language() const { return language_; }
+  unsigned max_idle() const { return max_idle_; }
+
+ private:
+  void checkin(TSParser *parser);
+
+  const TSLanguage *language_;
+  unsigned max_idle_;
+  std::mutex mutex_;
+  std::vector<TSParser *> idle_;
+};
+
+}  // namespace blade
+
+#endif  // TREE_SITTER_BLADE_PARSER_POOL_H_
@@ -0,0 +1,81 @@
+/// <reference types="tree-sitter-cli/dsl" />
+// @ts-check
+
+// Blade-only variant of the grammar. HTML is not parsed at all: everything
+// that is not Blade syntax is returned by the external scanner as large
+// `text` runs, so the parser never tracks tags and the scanner keeps no state.
+
+const echo_opening_tags = [
+  "{{", // regular
+  "{!!", // raw
+  "@{{" // escaped
+]
+
+const echo_closing_tags = [
+  "}}", // regular
+  "!!}", // raw
+]
+
+module.exports = grammar({
+  name: "blade_lite",
+
+  extras: $ => [],
+
+  externals: $ => [
+    $.text,
+    $.comment,
+    $.raw_echo_php,
+    $.directive_arguments,
+    $._verbatim_text,
+    $._php_block_code,
+    $._error_sentinel
+  ],
+
+  rules: {
+    fragment: $ => repeat($._node),
+
+    _node: $ => choice(
+      $.text,
+      $.comment,
+      $.echo_statement,
+      $.verbatim_statement,
+      $.php_statement,
+      $.directive
+    ),
+
+    echo_statement: $ => seq(
+      alias($.echo_start_tag, $.start_tag),
+      optional($.raw_echo_php),
+      alias($.echo_end_tag, $.end_tag)
+    ),
+
+    echo_start_tag: $ => choice(...echo_opening_tags),
+
+    echo_end_tag: $ => choice(...echo_closing_tags),
+
+    verbatim_statement: $ => seq(
+      alias('@verbatim', $.directive_name),
+      optional(alias($._verbatim_text, $.text)),
+      alias('@endverbatim', $.directive_name)
+    ),
+
+    php_statement: $ => choice(
+      seq(
+        alias('@php', $.directive_name),
+        $.directive_arguments
+      ),
+      seq(
+        alias('@php', $.directive_name),
+        optional(alias($._php_block_code, $.raw_echo_php)),
+        alias('@endphp', $.directive_name)
+      )
+    ),
+
+    directive: $ => seq(
+      $.directive_name,
+      optional($.directive_arguments)
+    ),
+
+    directive_name: $ => /@[a-zA-Z_][a-zA-Z0-9_]*(::[a-zA-Z0-9_]+)?/
+  }
+});
@@ -0,0 +1,260 @@
+#include <tree_sitter/parser.h>
+#include <wctype.h>
+
+namespace {
+
+enum TokenType {
+  TEXT,
+  COMMENT,
+  RAW_ECHO_PHP,
+  DIRECTIVE_ARGUMENTS,
+  VERBATIM_TEXT,
+  PHP_BLOCK_CODE,
+  ERROR_SENTINEL
+};
+
+inline bool is_word_char(int32_t c) {
+  return iswalnum(c) || c == '_';
+}
+
+// The lite scanner is stateless: nothing is pushed or popped between tokens,
+// so there is no payload to allocate, serialization is a no-op and the
+// parser never has to restore state.
+struct Scanner {
+  // Consumes a run of text up to, but not including, the next Blade construct:
+  // `{{`, `{!!`, `@{{` or an `@directive` that is not preceded by a word
+  // character (so that e-mail addresses stay text, like in Blade itself).
+  // Starting on one of those constructs returns false and lets the lexer
+  // recognise the delimiter, except for `{{--`, which is a comment.
+  bool scan_text(TSLexer *lexer, const bool *valid_symbols, bool has_content) {
+    int32_t previous = 0;
+
+    lexer->mark_end(lexer);
+    while (!lexer->eof(lexer)) {
+      int32_t c = lexer->lookahead;
+      if (c == '{') {
+        lexer->advance(lexer, false);
+        if (lexer->lookahead == '{') {
+          if (has_content) break;
+          lexer->advance(lexer, false);
+          if (lexer->lookahead == '-' && valid_symbols[COMMENT]) {
+            lexer->advance(lexer, false);
+            if (lexer->lookahead == '-') {
+              lexer->advance(lexer, false);
+              return scan_comment(lexer);
+            }
+          }
+          return false;
+        }
+        if (lexer->lookahead == '!') {
+          lexer->advance(lexer, false);
+          if (lexer->lookahead == '!') {
+            if (has_content) break;
+            return false;
+          }
+        }
+      } else if (c == '@' && !is_word_char(previous)) {
+        lexer->advance(lexer, false);
+        if (lexer->lookahead == '@') {
+          // `@@directive` is an escaped directive and renders as text.
+          lexer->advance(lexer, false);
+        } else if (iswalpha(lexer->lookahead) || lexer->lookahead == '_') {
+          if (has_content) break;
+          return false;
+        } else if (lexer->lookahead == '{') {
+          // `@{{` is an escaped echo; `@{` on its own is text.
+          lexer->advance(lexer, false);
+          if (lexer->lookahead == '{') {
+            if (has_content) break;
+            return false;
+          }
+        }
+      } else {
+        lexer->advance(lexer, false);
+      }
+      previous = c;
+      has_content = true;
+      lexer->mark_end(lexer);
+    }
+
+    if (!has_content) return false;
+    lexer->result_symbol = TEXT;
+    return true;
+  }
+
+  // Called after the opening `{{--`.
+  bool scan_comment(TSLexer *lexer) {
+    unsigned dashes = 0;
+    while (!lexer->eof(lexer)) {
+      switch (lexer->lookahead) {
+        case '-':
+          ++dashes;
+          break;
+        case '}':
+          if (dashes >= 2) {
+            lexer->advance(lexer, false);
+            if (lexer->lookahead == '}') {
+              lexer->advance(lexer, false);
+              lexer->mark_end(lexer);
+              lexer->result_symbol = COMMENT;
+              return true;
+            }
+            dashes = 0;
+            continue;
+          }
+        default:
+          dashes = 0;
+      }
+      lexer->advance(lexer, false);
+    }
+    return false;
+  }
+
+  bool scan_raw_php(TSLexer *lexer) {
+    bool has_content = false;
+
+    lexer->mark_end(lexer);
+    while (!lexer->eof(lexer)) {
+      if (lexer->lookahead == '}') {
+        lexer->advance(lexer, false);
+        if (lexer->lookahead == '}') break;
+      } else if (lexer->lookahead == '!') {
+        lexer->advance(lexer, false);
+        if (lexer->lookahead == '!') {
+          lexer->advance(lexer, false);
+          if (lexer->lookahead == '}') break;
+        }
+      } else {
+        lexer->advance(lexer, false);
+      }
+      has_content = true;
+      lexer->mark_end(lexer);
+    }
+
+    if (!has_content) return false;
+    lexer->result_symbol = RAW_ECHO_PHP;
+    return true;
+  }
+
+  // Balanced parentheses after a directive name, e.g. `@if ($a && f($b))`.
+  // Parentheses inside PHP string literals are ignored. Called on the `(`.
+  bool scan_directive_arguments(TSLexer *lexer) {
+    unsigned depth = 0;
+    int32_t quote = 0;
+    while (!lexer->eof(lexer)) {
+      int32_t c = lexer->lookahead;
+      lexer->advance(lexer, false);
+      if (quote) {
+        if (c == '\\') {
+          lexer->advance(lexer, false);
+        } else if (c == quote) {
+          quote = 0;
+        }
+      } else if (c == '\'' || c == '"') {
+        quote = c;
+      } else if (c == '(') {
+        ++depth;
+      } else if (c == ')' && --depth == 0) {
+        lexer->mark_end(lexer);
+        lexer->result_symbol = DIRECTIVE_ARGUMENTS;
+        return true;
+      }
+    }
+    return false;
+  }
+
+  // Everything up to `end_directive` (e.g. `@endverbatim`), which is left for
+  // the lexer. `has_content` is set when the caller already consumed part of
+  // the token.
+  bool scan_until(TSLexer *lexer, const char *end_directive, TokenType symbol, bool has_content) {
+    unsigned delimiter_index = 0;
+
+    lexer->mark_end(lexer);
+    while (!lexer->eof(lexer)) {
+      if (lexer->lookahead == end_directive[delimiter_index]) {
+        delimiter_index++;
+        if (!end_directive[delimiter_index]) break;
+        lexer->advance(lexer, false);
+      } else if (delimiter_index > 0) {
+        // A partial match is content. The end directives only contain `@`
+        // as their first character, so the match can only restart on the
+        // current character, which is checked again (as in `@@endverbatim`).
+        delimiter_index = 0;
+        has_content = true;
+        lexer->mark_end(lexer);
+      } else {
+        lexer->advance(lexer, false);
+        has_content = true;
+        lexer->mark_end(lexer);
+      }
+    }
+
+    if (!has_content) return false;
+    lexer->result_symbol = symbol;
+    return true;
+  }
+
+  bool scan(TSLexer *lexer, const bool *valid_symbols) {
+    if (valid_symbols[ERROR_SENTINEL]) {
+      return scan_text(lexer, valid_symbols, false);
+    }
+
+    if (valid_symbols[VERBATIM_TEXT]) {
+      return scan_until(lexer, "@endverbatim", VERBATIM_TEXT, false);
+    }
+
+    if (valid_symbols[RAW_ECHO_PHP]) {
+      return scan_raw_php(lexer);
+    }
+
+    // Blanks between a directive name and its arguments belong to the
+    // arguments (` ($a)` in `@if ($a)`). When no `(` follows them they are
+    // the start of the text or PHP code that comes next instead, so they are
+    // consumed rather than skipped: the lexer cannot go back to them.
+    bool has_blanks = false;
+    if (valid_symbols[DIRECTIVE_ARGUMENTS]) {
+      while (lexer->lookahead == ' ' || lexer->lookahead == '\t') {
+        lexer->advance(lexer, false);
+        has_blanks = true;
+      }
+      if (lexer->lookahead == '(') return scan_directive_arguments(lexer);
+    }
+
+    if (valid_symbols[PHP_BLOCK_CODE]) {
+      return scan_until(lexer, "@endphp", PHP_BLOCK_CODE, has_blanks);
+    }
+
+    if (valid_symbols[TEXT]) {
+      return scan_text(lexer, valid_symbols, has_blanks);
+    }
+
+    return false;
+  }
+};
+
+}
+
+extern "C" {
+
+// There is no state to allocate, so the payload is always NULL.
+void *tree_sitter_blade_lite_external_scanner_create() {
+  return NULL;
+}
+
+bool tree_sitter_blade_lite_external_scanner_scan(void *payload, TSLexer *lexer,
+                                                 const bool *valid_symbols) {
+  Scanner scanner;
+  return scanner.scan(lexer, valid_symbols);
+}
+
+unsigned tree_sitter_blade_lite_external_scanner_serialize(void *payload, char *buffer) {
+  return 0;
+}
+
+void tree_sitter_blade_lite_external_scanner_deserialize(void *payload, const char *buffer, unsigned length) {
+}
+
+void tree_sitter_blade_lite_external_scanner_destroy(void *payload) {
+}
+
+}
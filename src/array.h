@@ -0,0 +1,102 @@
+#ifndef TREE_SITTER_BLADE_ARRAY_H_
+#define TREE_SITTER_BLADE_ARRAY_H_
+
+#include <tree_sitter/alloc.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+// A growable array of trivially copyable elements over ts_realloc/ts_free.
+// The scanner is built without exceptions and without libstdc++, so this
+// takes the place of std::vector; running out of memory aborts, as the
+// runtime's default allocator does.
+template <typename T>
+struct Array {
+  T *contents = NULL;
+  uint32_t size = 0;
+  uint32_t capacity = 0;
+
+  Array() {}
+  Array(const Array &) = delete;
+  Array &operator=(const Array &) = delete;
+
+  ~Array() {
+    ts_free(contents);
+  }
+
+  bool empty() const { return size == 0; }
+  T &operator[](uint32_t index) { return contents[index]; }
+  const T &operator[](uint32_t index) const { return contents[index]; }
+  T &back() { return contents[size - 1]; }
+  const T &back() const { return contents[size - 1]; }
+
+  void reserve(uint32_t new_capacity) {
+    if (new_capacity <= capacity) return;
+    if (new_capacity < 2 * capacity) new_capacity = 2 * capacity;
+    if (new_capacity < 8) new_capacity = 8;
+    void *new_contents = ts_realloc(contents, new_capacity * sizeof(T));
+    if (!new_contents) abort();
+    contents = static_cast<T *>(new_contents);
+    capacity = new_capacity;
+  }
+
+  void push(const T &element) {
+    reserve(size + 1);
+    contents[size++] = element;
+  }
+
+  void pop() { size--; }
+  void clear() { size = 0; }
+};
+
+// An Array that keeps its first N elements inside the object and only moves
+// to the heap once it outgrows them. The inline storage is left uninitialized
+// until elements are pushed into it.
+template <typename T, uint32_t N>
+struct SmallArray {
+  T *contents = reinterpret_cast<T *>(inline_storage);
+  uint32_t size = 0;
+  uint32_t capacity = N;
+
+  SmallArray() {}
+  SmallArray(const SmallArray &) = delete;
+  SmallArray &operator=(const SmallArray &) = delete;
+
+  ~SmallArray() {
+    if (!is_inline()) ts_free(contents);
+  }
+
+  bool is_inline() const { return contents == reinterpret_cast<const T *>(inline_storage); }
+  bool empty() const { return size == 0; }
+  T &operator[](uint32_t index) { return contents[index]; }
+  const T &operator[](uint32_t index) const { return contents[index]; }
+  T &back() { return contents[size - 1]; }
+  const T &back() const { return contents[size - 1]; }
+
+  void reserve(uint32_t new_capacity) {
+    if (new_capacity <= capacity) return;
+    if (new_capacity < 2 * capacity) new_capacity = 2 * capacity;
+    void *new_contents;
+    if (is_inline()) {
+      new_contents = ts_malloc(new_capacity * sizeof(T));
+      if (new_contents) memcpy(new_contents, contents, size * sizeof(T));
+    } else {
+      new_contents = ts_realloc(contents, new_capacity * sizeof(T));
+    }
+    if (!new_contents) abort();
+    contents = static_cast<T *>(new_contents);
+    capacity = new_capacity;
+  }
+
+  void push(const T &element) {
+    reserve(size + 1);
+    contents[size++] = element;
+  }
+
+  void pop() { size--; }
+  void clear() { size = 0; }
+
+  alignas(T) char inline_storage[N * sizeof(T)];
+};
+
+#endif  // TREE_SITTER_BLADE_ARRAY_H_
@@ -1,25 +1,41 @@
 #include <tree_sitter/parser.h>
-#include <algorithm>
-#include <vector>
-#include <string>
-#include <cwctype>
-#include <cstring>
-#include <iostream>
+#include <new>
+#include <string.h>
+#include <wctype.h>
+#include "array.h"
 #include "tag.h"
+#include "scanner_pool.h"
+#include "scanner_stats.h"
+#include "scanner_trace.h"
 
 // Some helper macros
 #define PEEK lexer->lookahead
-#define S_ADVANCE lexer->advance(lexer, false)
-#define S_SKIP lexer->advance(lexer, true)
+#define S_ADVANCE advance(lexer, false)
+#define S_SKIP advance(lexer, true)
 #define S_MARK_END lexer->mark_end(lexer)
 #define S_RESULT(s) lexer->result_symbol = s;
 #define S_EOF lexer->eof(lexer)
 #define SYM(s) (valid_symbols[s])
 
-namespace {
+#ifdef TREE_SITTER_BLADE_STATS
+#define STAT(statement) statement
+#else
+#define STAT(statement)
+#endif
+
+#ifdef TREE_SITTER_BLADE_TRACE
+#include <stdio.h>
+#if defined(__x86_64__) || defined(_M_X64)
+#include <x86intrin.h>
+#else
+#include <time.h>
+#endif
+#define TRACE(statement) statement
+#else
+#define TRACE(statement)
+#endif
 
-using std::vector;
-using std::string;
+namespace {
 
 enum TokenType {
   START_TAG_NAME,
@@ -31,29 +47,95 @@ enum TokenType {
   IMPLICIT_END_TAG,
   RAW_TEXT,
   COMMENT,
-  RAW_ECHO_PHP
+  RAW_ECHO_PHP,
+  TOKEN_TYPE_COUNT
 };
 
-struct Scanner {
-  Scanner() {}
+#ifdef TREE_SITTER_BLADE_STATS
+static_assert(TOKEN_TYPE_COUNT == TREE_SITTER_BLADE_TOKEN_TYPE_COUNT &&
+              unsigned(IMPLICIT_END_TAG) == unsigned(TS_BLADE_TOKEN_IMPLICIT_END_TAG) &&
+              unsigned(RAW_ECHO_PHP) == unsigned(TS_BLADE_TOKEN_RAW_ECHO_PHP),
+              "scanner_stats.h is out of sync with TokenType");
+
+thread_local TSBladeScannerStats stats;
+
+inline void record_depth(size_t depth) {
+  if (depth > stats.max_stack_depth) stats.max_stack_depth = depth;
+}
 
+inline void record_scan(const bool *valid_symbols) {
+  stats.scan_calls++;
+  for (unsigned i = 0; i < TOKEN_TYPE_COUNT; i++) {
+    if (valid_symbols[i]) stats.valid[i]++;
+  }
+}
+#endif
+
+#ifdef TREE_SITTER_BLADE_TRACE
+#ifndef TREE_SITTER_BLADE_TRACE_SIZE
+#define TREE_SITTER_BLADE_TRACE_SIZE 4096
+#endif
+
+struct TraceBuffer {
+  TSBladeTraceEntry entries[TREE_SITTER_BLADE_TRACE_SIZE];
+  uint64_t count;
+};
+
+thread_local TraceBuffer trace_buffer;
+thread_local uint8_t trace_path;
+thread_local uint32_t trace_bytes;
+
+inline uint64_t trace_clock() {
+#if defined(__x86_64__) || defined(_M_X64)
+  return __rdtsc();
+#else
+  struct timespec now;
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  return static_cast<uint64_t>(now.tv_sec) * 1000000000 + now.tv_nsec;
+#endif
+}
+
+inline void record_trace(const bool *valid_symbols, uint8_t result, uint64_t ticks) {
+  TSBladeTraceEntry &entry = trace_buffer.entries[trace_buffer.count++ % TREE_SITTER_BLADE_TRACE_SIZE];
+  entry.bytes = trace_bytes;
+  entry.valid_symbols = 0;
+  for (unsigned i = 0; i < TOKEN_TYPE_COUNT; i++) {
+    if (valid_symbols[i]) entry.valid_symbols |= 1 << i;
+  }
+  entry.path = trace_path;
+  entry.result = result;
+  entry.ticks = ticks;
+}
+#endif
+
+// Open tags kept inside the scanner itself; deeper nesting spills to the heap.
+// Typical views stay well below this depth. 0 keeps every tag on the heap.
+#ifndef TREE_SITTER_BLADE_INLINE_TAGS
+#define TREE_SITTER_BLADE_INLINE_TAGS 32
+#endif
+
+// When `RECOVER` is false the scanner assumes well-formed HTML: end tags are
+// never inferred from content models or mismatched closing tags, only void
+// elements are closed implicitly.
+template <bool RECOVER>
+struct Scanner {
   unsigned serialize(char *buffer) {
-    uint16_t tag_count = tags.size() > UINT16_MAX ? UINT16_MAX : tags.size();
+    uint16_t tag_count = tags.size > UINT16_MAX ? UINT16_MAX : tags.size;
     uint16_t serialized_tag_count = 0;
 
     unsigned i = sizeof(tag_count);
-    std::memcpy(&buffer[i], &tag_count, sizeof(tag_count));
+    memcpy(&buffer[i], &tag_count, sizeof(tag_count));
     i += sizeof(tag_count);
 
     for (; serialized_tag_count < tag_count; serialized_tag_count++) {
       Tag &tag = tags[serialized_tag_count];
       if (tag.type == CUSTOM) {
-        unsigned name_length = tag.custom_tag_name.size();
+        unsigned name_length = tag.name_length;
         if (name_length > UINT8_MAX) name_length = UINT8_MAX;
         if (i + 2 + name_length >= TREE_SITTER_SERIALIZATION_BUFFER_SIZE) break;
         buffer[i++] = static_cast<char>(tag.type);
         buffer[i++] = name_length;
-        tag.custom_tag_name.copy(&buffer[i], name_length);
+        memcpy(&buffer[i], &names[tag.name_offset], name_length);
         i += name_length;
       } else {
         if (i + 1 >= TREE_SITTER_SERIALIZATION_BUFFER_SIZE) break;
@@ -61,51 +143,103 @@ struct Scanner {
       }
     }
 
-    std::memcpy(&buffer[0], &serialized_tag_count, sizeof(serialized_tag_count));
+    memcpy(&buffer[0], &serialized_tag_count, sizeof(serialized_tag_count));
+    STAT(stats.serialize_calls++);
+    STAT(stats.serialize_bytes += i);
     return i;
   }
 
   void deserialize(const char *buffer, unsigned length) {
+    STAT(stats.deserialize_calls++);
+    STAT(stats.deserialize_bytes += length);
     tags.clear();
+    names.clear();
     if (length > 0) {
       unsigned i = 0;
       uint16_t tag_count, serialized_tag_count;
 
-      std::memcpy(&serialized_tag_count, &buffer[i], sizeof(serialized_tag_count));
+      memcpy(&serialized_tag_count, &buffer[i], sizeof(serialized_tag_count));
       i += sizeof(serialized_tag_count);
 
-      std::memcpy(&tag_count, &buffer[i], sizeof(tag_count));
+      memcpy(&tag_count, &buffer[i], sizeof(tag_count));
       i += sizeof(tag_count);
 
-      tags.resize(tag_count);
+      tags.reserve(tag_count);
+      STAT(record_depth(tag_count));
       for (unsigned j = 0; j < serialized_tag_count; j++) {
-        Tag &tag = tags[j];
-        tag.type = static_cast<TagType>(buffer[i++]);
-        if (tag.type == CUSTOM) {
-          uint16_t name_length = static_cast<uint8_t>(buffer[i++]);
-          tag.custom_tag_name.assign(&buffer[i], &buffer[i + name_length]);
+        TagType type = static_cast<TagType>(buffer[i++]);
+        uint32_t name_length = 0;
+        if (type == CUSTOM) {
+          name_length = static_cast<uint8_t>(buffer[i++]);
+          if (name_length > 0) {
+            names.reserve(names.size + name_length);
+            memcpy(&names.contents[names.size], &buffer[i], name_length);
+          }
           i += name_length;
         }
+        push_tag(type, name_length);
+      }
+      for (unsigned j = serialized_tag_count; j < tag_count; j++) {
+        tags.push(Tag());
       }
     }
   }
 
-  string scan_tag_name(TSLexer *lexer) {
-    string tag_name;
+  // The name most recently read by `scan_tag_name`, which sits in the free
+  // space after the names of the open custom tags.
+  const char *scanned_name() const {
+    return names.contents + names.size;
+  }
+
+  // Pushes a tag whose name was just read into the name arena, claiming the
+  // name for it if it is a custom tag.
+  void push_tag(TagType type, uint32_t name_length) {
+    if (type != CUSTOM) name_length = 0;
+    tags.push(Tag(type, names.size, name_length));
+    names.size += name_length;
+  }
+
+  void pop_tag() {
+    if (tags.back().type == CUSTOM) names.size = tags.back().name_offset;
+    tags.pop();
+  }
+
+  bool matches(const Tag &tag, TagType type, uint32_t name_length) const {
+    if (tag.type != type) return false;
+    if (type != CUSTOM) return true;
+    return tag.name_length == name_length &&
+      memcmp(&names[tag.name_offset], scanned_name(), name_length) == 0;
+  }
+
+  void advance(TSLexer *lexer, bool skip) {
+#if defined(TREE_SITTER_BLADE_STATS) || defined(TREE_SITTER_BLADE_TRACE)
+    int32_t c = lexer->lookahead;
+    unsigned size = lexer->eof(lexer) ? 0 : c < 0x80 ? 1 : c < 0x800 ? 2 : c < 0x10000 ? 3 : 4;
+    STAT((skip ? stats.bytes_skipped : stats.bytes_advanced) += size);
+    TRACE(trace_bytes += size);
+#endif
+    lexer->advance(lexer, skip);
+  }
+
+  // Reads an upper-cased tag name into the name arena without claiming it
+  // (see `scanned_name`) and returns its length.
+  uint32_t scan_tag_name(TSLexer *lexer) {
+    uint32_t length = 0;
     while (iswalnum(lexer->lookahead) ||
            lexer->lookahead == '-' ||
            lexer->lookahead == ':') {
-      tag_name += towupper(lexer->lookahead);
-      lexer->advance(lexer, false);
+      names.reserve(names.size + length + 1);
+      names.contents[names.size + length++] = static_cast<char>(towupper(lexer->lookahead));
+      advance(lexer, false);
     }
-    return tag_name;
+    return length;
   }
 
   bool scan_comment(TSLexer *lexer) {
     if (lexer->lookahead != '-') return false;
-    lexer->advance(lexer, false);
+    advance(lexer, false);
     if (lexer->lookahead != '-') return false;
-    lexer->advance(lexer, false);
+    advance(lexer, false);
 
     unsigned dashes = 0;
     while (lexer->lookahead) {
@@ -116,36 +250,37 @@ struct Scanner {
         case '>':
           if (dashes >= 2) {
             lexer->result_symbol = COMMENT;
-            lexer->advance(lexer, false);
+            advance(lexer, false);
             lexer->mark_end(lexer);
             return true;
           }
         default:
           dashes = 0;
       }
-      lexer->advance(lexer, false);
+      advance(lexer, false);
     }
     return false;
   }
 
   bool scan_raw_text(TSLexer *lexer) {
-    if (!tags.size()) return false;
+    if (tags.empty()) return false;
 
     lexer->mark_end(lexer);
 
-    const string &end_delimiter = tags.back().type == SCRIPT
+    const char *end_delimiter = tags.back().type == SCRIPT
       ? "</SCRIPT"
       : "</STYLE";
+    size_t end_delimiter_length = strlen(end_delimiter);
 
     unsigned delimiter_index = 0;
     while (lexer->lookahead) {
       if (towupper(lexer->lookahead) == end_delimiter[delimiter_index]) {
         delimiter_index++;
-        if (delimiter_index == end_delimiter.size()) break;
-        lexer->advance(lexer, false);
+        if (delimiter_index == end_delimiter_length) break;
+        advance(lexer, false);
       } else {
         delimiter_index = 0;
-        lexer->advance(lexer, false);
+        advance(lexer, false);
         lexer->mark_end(lexer);
       }
     }
@@ -186,36 +321,53 @@ struct Scanner {
   bool scan_implicit_end_tag(TSLexer *lexer) {
     Tag *parent = tags.empty() ? NULL : &tags.back();
 
+    if (!RECOVER) {
+      if (!parent || !parent->is_void()) return false;
+      // `<br></br>`: let the end tag close the void element itself.
+      if (lexer->lookahead == '/') {
+        advance(lexer, false);
+        uint32_t name_length = scan_tag_name(lexer);
+        if (name_length && matches(*parent, Tag::type_for_name(scanned_name(), name_length), name_length)) {
+          return false;
+        }
+      }
+      pop_tag();
+      lexer->result_symbol = IMPLICIT_END_TAG;
+      return true;
+    }
+
     bool is_closing_tag = false;
     if (lexer->lookahead == '/') {
       is_closing_tag = true;
-      lexer->advance(lexer, false);
+      advance(lexer, false);
     } else {
       if (parent && parent->is_void()) {
-        tags.pop_back();
+        pop_tag();
         lexer->result_symbol = IMPLICIT_END_TAG;
         return true;
       }
     }
 
-    string tag_name = scan_tag_name(lexer);
-    if (tag_name.empty()) return false;
+    uint32_t name_length = scan_tag_name(lexer);
+    if (name_length == 0) return false;
 
-    Tag next_tag = Tag::for_name(tag_name);
+    TagType next_type = Tag::type_for_name(scanned_name(), name_length);
 
     if (is_closing_tag) {
       // The tag correctly closes the topmost element on the stack
-      if (!tags.empty() && tags.back() == next_tag) return false;
+      if (!tags.empty() && matches(tags.back(), next_type, name_length)) return false;
 
       // Otherwise, dig deeper and queue implicit end tags (to be nice in
       // the case of malformed HTML)
-      if (std::find(tags.begin(), tags.end(), next_tag) != tags.end()) {
-        tags.pop_back();
-        lexer->result_symbol = IMPLICIT_END_TAG;
-        return true;
+      for (uint32_t i = 0; i < tags.size; i++) {
+        if (matches(tags[i], next_type, name_length)) {
+          pop_tag();
+          lexer->result_symbol = IMPLICIT_END_TAG;
+          return true;
+        }
       }
-    } else if (parent && !parent->can_contain(next_tag)) {
-      tags.pop_back();
+    } else if (parent && !parent->can_contain(Tag(next_type, 0, 0))) {
+      pop_tag();
       lexer->result_symbol = IMPLICIT_END_TAG;
       return true;
     }
@@ -224,11 +376,13 @@ struct Scanner {
   }
 
   bool scan_start_tag_name(TSLexer *lexer) {
-    string tag_name = scan_tag_name(lexer);
-    if (tag_name.empty()) return false;
-    Tag tag = Tag::for_name(tag_name);
-    tags.push_back(tag);
-    switch (tag.type) {
+    uint32_t name_length = scan_tag_name(lexer);
+    if (name_length == 0) return false;
+    TagType type = Tag::type_for_name(scanned_name(), name_length);
+    push_tag(type, name_length);
+    STAT(record_depth(tags.size));
+    STAT(if (type == CUSTOM) stats.custom_tags++);
+    switch (type) {
       case SCRIPT:
         lexer->result_symbol = SCRIPT_START_TAG_NAME;
         break;
@@ -243,11 +397,11 @@ struct Scanner {
   }
 
   bool scan_end_tag_name(TSLexer *lexer) {
-    string tag_name = scan_tag_name(lexer);
-    if (tag_name.empty()) return false;
-    Tag tag = Tag::for_name(tag_name);
-    if (!tags.empty() && tags.back() == tag) {
-      tags.pop_back();
+    uint32_t name_length = scan_tag_name(lexer);
+    if (name_length == 0) return false;
+    TagType type = Tag::type_for_name(scanned_name(), name_length);
+    if (!tags.empty() && matches(tags.back(), type, name_length)) {
+      pop_tag();
       lexer->result_symbol = END_TAG_NAME;
     } else {
       lexer->result_symbol = ERRONEOUS_END_TAG_NAME;
@@ -256,11 +410,11 @@ struct Scanner {
   }
 
   bool scan_self_closing_tag_delimiter(TSLexer *lexer) {
-    lexer->advance(lexer, false);
+    advance(lexer, false);
     if (lexer->lookahead == '>') {
-      lexer->advance(lexer, false);
+      advance(lexer, false);
       if (!tags.empty()) {
-        tags.pop_back();
+        pop_tag();
         lexer->result_symbol = SELF_CLOSING_TAG_DELIMITER;
       }
       return true;
@@ -270,46 +424,55 @@ struct Scanner {
 
   bool scan(TSLexer *lexer, const bool *valid_symbols) {
     while (iswspace(lexer->lookahead)) {
-      lexer->advance(lexer, true);
+      advance(lexer, true);
     }
 
     if (valid_symbols[RAW_TEXT] && !valid_symbols[START_TAG_NAME] && !valid_symbols[END_TAG_NAME]) {
+      TRACE(trace_path = TS_BLADE_TRACE_RAW_TEXT);
       return scan_raw_text(lexer);
     }
 
     if (SYM(RAW_ECHO_PHP)) {
+      TRACE(trace_path = TS_BLADE_TRACE_RAW_PHP);
       return scan_raw_php(lexer);
     }
 
     switch (lexer->lookahead) {
       case '<':
         lexer->mark_end(lexer);
-        lexer->advance(lexer, false);
+        advance(lexer, false);
 
         if (lexer->lookahead == '!') {
-          lexer->advance(lexer, false);
+          advance(lexer, false);
+          TRACE(trace_path = TS_BLADE_TRACE_COMMENT);
           return scan_comment(lexer);
         }
 
         if (valid_symbols[IMPLICIT_END_TAG]) {
+          TRACE(trace_path = TS_BLADE_TRACE_IMPLICIT_END_TAG);
           return scan_implicit_end_tag(lexer);
         }
         break;
 
       case '\0':
         if (valid_symbols[IMPLICIT_END_TAG]) {
+          TRACE(trace_path = TS_BLADE_TRACE_IMPLICIT_END_TAG);
           return scan_implicit_end_tag(lexer);
         }
         break;
 
       case '/':
         if (valid_symbols[SELF_CLOSING_TAG_DELIMITER]) {
+          TRACE(trace_path = TS_BLADE_TRACE_SELF_CLOSING_TAG_DELIMITER);
           return scan_self_closing_tag_delimiter(lexer);
         }
         break;
 
       default:
         if ((valid_symbols[START_TAG_NAME] || valid_symbols[END_TAG_NAME]) && !valid_symbols[RAW_TEXT]) {
+          TRACE(trace_path = valid_symbols[START_TAG_NAME]
+            ? TS_BLADE_TRACE_START_TAG_NAME
+            : TS_BLADE_TRACE_END_TAG_NAME);
           return valid_symbols[START_TAG_NAME]
             ? scan_start_tag_name(lexer)
             : scan_end_tag_name(lexer);
@@ -319,36 +482,219 @@ struct Scanner {
     return false;
   }
 
-  vector<Tag> tags;
+#if TREE_SITTER_BLADE_INLINE_TAGS > 0
+  SmallArray<Tag, TREE_SITTER_BLADE_INLINE_TAGS> tags;
+#else
+  Array<Tag> tags;
+#endif
+  Array<char> names;
+};
+
+// Opt-in: pooled scanners outlive their thread unless the host clears the
+// pool (see scanner_pool.h).
+#ifndef TREE_SITTER_BLADE_SCANNER_POOL_SIZE
+#define TREE_SITTER_BLADE_SCANNER_POOL_SIZE 0
+#endif
+
+// Released scanners of one kind, kept for reuse on the thread that released
+// them. Trivially destructible so that it needs no thread-exit hook from the
+// C++ runtime.
+struct ScannerPool {
+  void *scanners[TREE_SITTER_BLADE_SCANNER_POOL_SIZE > 0 ? TREE_SITTER_BLADE_SCANNER_POOL_SIZE : 1];
+  unsigned count;
 };
 
+// Indexed by RECOVER.
+thread_local ScannerPool scanner_pools[2];
+
+template <bool RECOVER>
+void free_scanner(Scanner<RECOVER> *scanner) {
+  scanner->~Scanner<RECOVER>();
+  ts_free(scanner);
+}
+
+template <bool RECOVER>
+void clear_pool() {
+  ScannerPool &pool = scanner_pools[RECOVER];
+  while (pool.count > 0) {
+    free_scanner(static_cast<Scanner<RECOVER> *>(pool.scanners[--pool.count]));
+  }
+}
+
+template <bool RECOVER>
+void *create() {
+  ScannerPool &pool = scanner_pools[RECOVER];
+  if (pool.count > 0) {
+    Scanner<RECOVER> *scanner = static_cast<Scanner<RECOVER> *>(pool.scanners[--pool.count]);
+    scanner->tags.clear();
+    scanner->names.clear();
+    return scanner;
+  }
+  void *memory = ts_malloc(sizeof(Scanner<RECOVER>));
+  return new (memory) Scanner<RECOVER>();
+}
+
+template <bool RECOVER>
+bool scan(void *payload, TSLexer *lexer, const bool *valid_symbols) {
+  Scanner<RECOVER> *scanner = static_cast<Scanner<RECOVER> *>(payload);
+  STAT(record_scan(valid_symbols));
+  TRACE(trace_bytes = 0);
+  TRACE(trace_path = TS_BLADE_TRACE_NO_TOKEN);
+  TRACE(uint64_t start = trace_clock());
+  bool result = scanner->scan(lexer, valid_symbols);
+  TRACE(uint64_t ticks = trace_clock() - start);
+  STAT(if (result && lexer->result_symbol < TOKEN_TYPE_COUNT) stats.emitted[lexer->result_symbol]++);
+  TRACE(record_trace(valid_symbols, result ? lexer->result_symbol : TS_BLADE_TRACE_NO_RESULT, ticks));
+  return result;
+}
+
+template <bool RECOVER>
+unsigned serialize(void *payload, char *buffer) {
+  Scanner<RECOVER> *scanner = static_cast<Scanner<RECOVER> *>(payload);
+  return scanner->serialize(buffer);
+}
+
+template <bool RECOVER>
+void deserialize(void *payload, const char *buffer, unsigned length) {
+  Scanner<RECOVER> *scanner = static_cast<Scanner<RECOVER> *>(payload);
+  scanner->deserialize(buffer, length);
+}
+
+template <bool RECOVER>
+void destroy(void *payload) {
+  ScannerPool &pool = scanner_pools[RECOVER];
+  if (pool.count < TREE_SITTER_BLADE_SCANNER_POOL_SIZE) {
+    pool.scanners[pool.count++] = payload;
+    return;
+  }
+  free_scanner(static_cast<Scanner<RECOVER> *>(payload));
+}
+
+TSLanguage make_strict_language(const TSLanguage *language) {
+  TSLanguage result = *language;
+  result.external_scanner.create = create<false>;
+  result.external_scanner.destroy = destroy<false>;
+  result.external_scanner.scan = scan<false>;
+  result.external_scanner.serialize = serialize<false>;
+  result.external_scanner.deserialize = deserialize<false>;
+  return result;
+}
+
 }
 
 extern "C" {
 
+// Defined in parser.c; see tree_sitter_blade_strict.
+const TSLanguage *tree_sitter_blade(void);
+
 void *tree_sitter_blade_external_scanner_create() {
-  return new Scanner();
+  return create<true>();
 }
 
 bool tree_sitter_blade_external_scanner_scan(void *payload, TSLexer *lexer,
                                             const bool *valid_symbols) {
-  Scanner *scanner = static_cast<Scanner *>(payload);
-  return scanner->scan(lexer, valid_symbols);
+  return scan<true>(payload, lexer, valid_symbols);
 }
 
 unsigned tree_sitter_blade_external_scanner_serialize(void *payload, char *buffer) {
-  Scanner *scanner = static_cast<Scanner *>(payload);
-  return scanner->serialize(buffer);
+  return serialize<true>(payload, buffer);
 }
 
 void tree_sitter_blade_external_scanner_deserialize(void *payload, const char *buffer, unsigned length) {
-  Scanner *scanner = static_cast<Scanner *>(payload);
-  scanner->deserialize(buffer, length);
+  deserialize<true>(payload, buffer, length);
 }
 
 void tree_sitter_blade_external_scanner_destroy(void *payload) {
-  Scanner *scanner = static_cast<Scanner *>(payload);
-  delete scanner;
+  destroy<true>(payload);
+}
+
+void tree_sitter_blade_scanner_pool_clear(void) {
+  clear_pool<true>();
+  clear_pool<false>();
+}
+
+bool tree_sitter_blade_scanner_stats(TSBladeScannerStats *result) {
+#ifdef TREE_SITTER_BLADE_STATS
+  *result = stats;
+  return true;
+#else
+  return false;
+#endif
+}
+
+void tree_sitter_blade_scanner_stats_reset(void) {
+  STAT(stats = TSBladeScannerStats());
+}
+
+size_t tree_sitter_blade_scanner_trace(TSBladeTraceEntry *entries, size_t capacity) {
+#ifdef TREE_SITTER_BLADE_TRACE
+  uint64_t count = trace_buffer.count;
+  size_t length = count < TREE_SITTER_BLADE_TRACE_SIZE ? count : TREE_SITTER_BLADE_TRACE_SIZE;
+  if (length > capacity) length = capacity;
+  for (size_t i = 0; i < length; i++) {
+    entries[i] = trace_buffer.entries[(count - length + i) % TREE_SITTER_BLADE_TRACE_SIZE];
+  }
+  return length;
+#else
+  return 0;
+#endif
+}
+
+void tree_sitter_blade_scanner_trace_clear(void) {
+  TRACE(trace_buffer.count = 0);
+}
+
+bool tree_sitter_blade_scanner_trace_write(const char *path) {
+#ifdef TREE_SITTER_BLADE_TRACE
+  uint64_t count = trace_buffer.count;
+  uint32_t length = count < TREE_SITTER_BLADE_TRACE_SIZE ? count : TREE_SITTER_BLADE_TRACE_SIZE;
+  FILE *file = fopen(path, "wb");
+  if (!file) return false;
+  uint32_t magic = TS_BLADE_TRACE_FILE_MAGIC;
+  bool ok =
+    fwrite(&magic, sizeof(magic), 1, file) == 1 &&
+    fwrite(&length, sizeof(length), 1, file) == 1;
+  for (uint32_t i = 0; ok && i < length; i++) {
+    const TSBladeTraceEntry &entry = trace_buffer.entries[(count - length + i) % TREE_SITTER_BLADE_TRACE_SIZE];
+    ok = fwrite(&entry, sizeof(entry), 1, file) == 1;
+  }
+  return fclose(file) == 0 && ok;
+#else
+  return false;
+#endif
+}
+
+// Same parse tables as `tree_sitter_blade`, but with a scanner that skips the
+// HTML error-recovery heuristics. Only use it on templates that are known to
+// be well-formed; malformed markup produces ERROR nodes instead of inferred
+// end tags.
+//
+// It copies the tables from `tree_sitter_blade`, so scanner.cc must be linked
+// into the same object as parser.c, as every build here does: a shared
+// library of the scanner alone fails to load with an undefined
+// `tree_sitter_blade`.
+//
+// The language is built on first use. With GCC and Clang that is done with
+// atomic builtins rather than a function-local static, whose guard would
+// pull in the C++ runtime.
+const TSLanguage *tree_sitter_blade_strict(void) {
+#if defined(__GNUC__)
+  static TSLanguage language;
+  static int state;  // 0: not built, 1: being built, 2: ready
+  if (__atomic_load_n(&state, __ATOMIC_ACQUIRE) != 2) {
+    int expected = 0;
+    if (__atomic_compare_exchange_n(&state, &expected, 1, false, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE)) {
+      language = make_strict_language(tree_sitter_blade());
+      __atomic_store_n(&state, 2, __ATOMIC_RELEASE);
+    } else {
+      while (__atomic_load_n(&state, __ATOMIC_ACQUIRE) != 2) {}
+    }
+  }
+  return &language;
+#else
+  static const TSLanguage language = make_strict_language(tree_sitter_blade());
+  return &language;
+#endif
 }
 
 }
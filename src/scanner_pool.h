@@ -0,0 +1,25 @@
+#ifndef TREE_SITTER_BLADE_SCANNER_POOL_H_
+#define TREE_SITTER_BLADE_SCANNER_POOL_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// When the scanner is compiled with TREE_SITTER_BLADE_SCANNER_POOL_SIZE set to
+// N > 0, scanners released when a parser is deleted are kept in a per-thread
+// pool of up to N and handed to the next Blade parser created on the same
+// thread, together with the tag and name storage they have already grown.
+// The default is 0: every scanner is freed with its parser.
+//
+// Pooled scanners are not freed when their thread exits, and they are freed
+// with whatever allocator is current at that point. Hosts that enable the
+// pool call this on a thread before it exits, and on every thread that used
+// Blade parsers before calling `ts_set_allocator` again. Without the pool it
+// does nothing.
+void tree_sitter_blade_scanner_pool_clear(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // TREE_SITTER_BLADE_SCANNER_POOL_H_
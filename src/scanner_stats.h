@@ -0,0 +1,60 @@
+#ifndef TREE_SITTER_BLADE_SCANNER_STATS_H_
+#define TREE_SITTER_BLADE_SCANNER_STATS_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// The external tokens, in the order of `externals` in grammar.js. They index
+// `valid` and `emitted` below.
+typedef enum {
+  TS_BLADE_TOKEN_START_TAG_NAME,
+  TS_BLADE_TOKEN_SCRIPT_START_TAG_NAME,
+  TS_BLADE_TOKEN_STYLE_START_TAG_NAME,
+  TS_BLADE_TOKEN_END_TAG_NAME,
+  TS_BLADE_TOKEN_ERRONEOUS_END_TAG_NAME,
+  TS_BLADE_TOKEN_SELF_CLOSING_TAG_DELIMITER,
+  TS_BLADE_TOKEN_IMPLICIT_END_TAG,
+  TS_BLADE_TOKEN_RAW_TEXT,
+  TS_BLADE_TOKEN_COMMENT,
+  TS_BLADE_TOKEN_RAW_ECHO_PHP,
+} TSBladeToken;
+
+#define TREE_SITTER_BLADE_TOKEN_TYPE_COUNT 10
+
+// Counters kept by the external scanner when it is compiled with
+// TREE_SITTER_BLADE_STATS defined. They are accumulated per thread, across
+// every Blade parser used on that thread.
+typedef struct {
+  uint64_t scan_calls;
+  // Scan calls in which each external token was valid, and the tokens that
+  // were actually produced, indexed by TSBladeToken.
+  uint64_t valid[TREE_SITTER_BLADE_TOKEN_TYPE_COUNT];
+  uint64_t emitted[TREE_SITTER_BLADE_TOKEN_TYPE_COUNT];
+  // UTF-8 bytes consumed by the scanner, as part of a token or as skipped
+  // whitespace.
+  uint64_t bytes_advanced;
+  uint64_t bytes_skipped;
+  uint64_t serialize_calls;
+  uint64_t serialize_bytes;
+  uint64_t deserialize_calls;
+  uint64_t deserialize_bytes;
+  uint64_t max_stack_depth;
+  uint64_t custom_tags;
+} TSBladeScannerStats;
+
+// Copies the calling thread's counters into `stats`. Returns false, and
+// leaves `stats` untouched, when the scanner was built without
+// TREE_SITTER_BLADE_STATS.
+bool tree_sitter_blade_scanner_stats(TSBladeScannerStats *stats);
+
+void tree_sitter_blade_scanner_stats_reset(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // TREE_SITTER_BLADE_SCANNER_STATS_H_
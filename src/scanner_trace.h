@@ -0,0 +1,61 @@
+#ifndef TREE_SITTER_BLADE_SCANNER_TRACE_H_
+#define TREE_SITTER_BLADE_SCANNER_TRACE_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// The scanner function that handled a `scan` call.
+typedef enum {
+  TS_BLADE_TRACE_NO_TOKEN,
+  TS_BLADE_TRACE_RAW_TEXT,
+  TS_BLADE_TRACE_RAW_PHP,
+  TS_BLADE_TRACE_COMMENT,
+  TS_BLADE_TRACE_IMPLICIT_END_TAG,
+  TS_BLADE_TRACE_SELF_CLOSING_TAG_DELIMITER,
+  TS_BLADE_TRACE_START_TAG_NAME,
+  TS_BLADE_TRACE_END_TAG_NAME,
+} TSBladeTracePath;
+
+#define TS_BLADE_TRACE_NO_RESULT 0xFF
+
+// One `scan` call. `bytes` is how far the call moved the lexer, counting
+// consumed and skipped UTF-8 bytes; the scanner API does not expose where in
+// the document that was. `valid_symbols` has bit N set when external token N
+// was valid; `result` is the emitted token or TS_BLADE_TRACE_NO_RESULT.
+// `ticks` are TSC cycles on x86-64 and nanoseconds elsewhere.
+typedef struct {
+  uint32_t bytes;
+  uint16_t valid_symbols;
+  uint8_t path;
+  uint8_t result;
+  uint64_t ticks;
+} TSBladeTraceEntry;
+
+// When the scanner is compiled with TREE_SITTER_BLADE_TRACE, each thread
+// keeps its last TREE_SITTER_BLADE_TRACE_SIZE (default 4096) scan calls in a
+// ring buffer. Copies up to `capacity` of the most recent entries, oldest
+// first, and returns how many were copied. Returns 0 when tracing is
+// compiled out.
+size_t tree_sitter_blade_scanner_trace(TSBladeTraceEntry *entries, size_t capacity);
+
+void tree_sitter_blade_scanner_trace_clear(void);
+
+// Written first in a trace file, followed by the entry count as a uint32_t
+// and the entries, all in native byte order.
+#define TS_BLADE_TRACE_FILE_MAGIC 0x54424c45
+
+// Writes the calling thread's ring buffer to `path` in the format read by
+// tools/trace-dump. Returns false if tracing is compiled out or the file
+// cannot be written.
+bool tree_sitter_blade_scanner_trace_write(const char *path);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // TREE_SITTER_BLADE_SCANNER_TRACE_H_
@@ -0,0 +1,11 @@
+#ifndef TREE_SITTER_BLADE_SCANNER_VERSION_H_
+#define TREE_SITTER_BLADE_SCANNER_VERSION_H_
+
+// Bump this whenever a change to the external scanner can change the trees
+// that are produced for some input, so that parse results cached by an older
+// build (see tools/parse_cache.h) are not reused. Changes to the generated
+// parse tables are detected without it, and so are changes to the generated
+// lexer in builds that pass a checksum of parser.c (as tools/Makefile does).
+#define TREE_SITTER_BLADE_SCANNER_VERSION 1
+
+#endif  // TREE_SITTER_BLADE_SCANNER_VERSION_H_
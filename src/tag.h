@@ -1,8 +1,11 @@
-#include <string>
-#include <map>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
 
-using std::string;
-using std::map;
+// tree-sitter-html's scanner declares its own Tag and TagType with a
+// different layout. Keeping these internal stops the linker from merging the
+// two sets of inline member functions when both grammars are linked together.
+namespace {
 
 enum TagType {
   AREA,
@@ -137,141 +140,197 @@ enum TagType {
 };
 
 
-static const map<string, TagType> get_tag_map() {
-  map<string, TagType> result;
-#define TAG(name) result[#name] = name
-  TAG(AREA);
-  TAG(BASE);
-  TAG(BASEFONT);
-  TAG(BGSOUND);
-  TAG(BR);
-  TAG(COL);
-  TAG(COMMAND);
-  TAG(EMBED);
-  TAG(FRAME);
-  TAG(HR);
-  TAG(IMAGE);
-  TAG(IMG);
-  TAG(INPUT);
-  TAG(ISINDEX);
-  TAG(KEYGEN);
-  TAG(LINK);
-  TAG(MENUITEM);
-  TAG(META);
-  TAG(NEXTID);
-  TAG(PARAM);
-  TAG(SOURCE);
-  TAG(TRACK);
-  TAG(WBR);
-  TAG(A);
-  TAG(ABBR);
-  TAG(ADDRESS);
-  TAG(ARTICLE);
-  TAG(ASIDE);
-  TAG(AUDIO);
-  TAG(B);
-  TAG(BDI);
-  TAG(BDO);
-  TAG(BLOCKQUOTE);
-  TAG(BODY);
-  TAG(BUTTON);
-  TAG(CANVAS);
-  TAG(CAPTION);
-  TAG(CITE);
-  TAG(CODE);
-  TAG(COLGROUP);
-  TAG(DATA);
-  TAG(DATALIST);
-  TAG(DD);
-  TAG(DEL);
-  TAG(DETAILS);
-  TAG(DFN);
-  TAG(DIALOG);
-  TAG(DIV);
-  TAG(DL);
-  TAG(DT);
-  TAG(EM);
-  TAG(FIELDSET);
-  TAG(FIGCAPTION);
-  TAG(FIGURE);
-  TAG(FOOTER);
-  TAG(FORM);
-  TAG(H1);
-  TAG(H2);
-  TAG(H3);
-  TAG(H4);
-  TAG(H5);
-  TAG(H6);
-  TAG(HEAD);
-  TAG(HEADER);
-  TAG(HGROUP);
-  TAG(HTML);
-  TAG(I);
-  TAG(IFRAME);
-  TAG(INS);
-  TAG(KBD);
-  TAG(LABEL);
-  TAG(LEGEND);
-  TAG(LI);
-  TAG(MAIN);
-  TAG(MAP);
-  TAG(MARK);
-  TAG(MATH);
-  TAG(MENU);
-  TAG(METER);
-  TAG(NAV);
-  TAG(NOSCRIPT);
-  TAG(OBJECT);
-  TAG(OL);
-  TAG(OPTGROUP);
-  TAG(OPTION);
-  TAG(OUTPUT);
-  TAG(P);
-  TAG(PICTURE);
-  TAG(PRE);
-  TAG(PROGRESS);
-  TAG(Q);
-  TAG(RB);
-  TAG(RP);
-  TAG(RT);
-  TAG(RTC);
-  TAG(RUBY);
-  TAG(S);
-  TAG(SAMP);
-  TAG(SCRIPT);
-  TAG(SECTION);
-  TAG(SELECT);
-  TAG(SLOT);
-  TAG(SMALL);
-  TAG(SPAN);
-  TAG(STRONG);
-  TAG(STYLE);
-  TAG(SUB);
-  TAG(SUMMARY);
-  TAG(SUP);
-  TAG(SVG);
-  TAG(TABLE);
-  TAG(TBODY);
-  TAG(TD);
-  TAG(TEMPLATE);
-  TAG(TEXTAREA);
-  TAG(TFOOT);
-  TAG(TH);
-  TAG(THEAD);
-  TAG(TIME);
-  TAG(TITLE);
-  TAG(TR);
-  TAG(U);
-  TAG(UL);
-  TAG(VAR);
-  TAG(VIDEO);
+struct TagName {
+  const char *name;
+  TagType type;
+};
+
+// Every known tag, sorted by name for `find_tag_type`. The table is constant
+// initialized, so loading the scanner runs no static constructors.
+static constexpr TagName TAG_NAMES[] = {
+#define TAG(name) {#name, name}
+  TAG(A),
+  TAG(ABBR),
+  TAG(ADDRESS),
+  TAG(AREA),
+  TAG(ARTICLE),
+  TAG(ASIDE),
+  TAG(AUDIO),
+  TAG(B),
+  TAG(BASE),
+  TAG(BASEFONT),
+  TAG(BDI),
+  TAG(BDO),
+  TAG(BGSOUND),
+  TAG(BLOCKQUOTE),
+  TAG(BODY),
+  TAG(BR),
+  TAG(BUTTON),
+  TAG(CANVAS),
+  TAG(CAPTION),
+  TAG(CITE),
+  TAG(CODE),
+  TAG(COL),
+  TAG(COLGROUP),
+  TAG(COMMAND),
+  TAG(DATA),
+  TAG(DATALIST),
+  TAG(DD),
+  TAG(DEL),
+  TAG(DETAILS),
+  TAG(DFN),
+  TAG(DIALOG),
+  TAG(DIV),
+  TAG(DL),
+  TAG(DT),
+  TAG(EM),
+  TAG(EMBED),
+  TAG(FIELDSET),
+  TAG(FIGCAPTION),
+  TAG(FIGURE),
+  TAG(FOOTER),
+  TAG(FORM),
+  TAG(FRAME),
+  TAG(H1),
+  TAG(H2),
+  TAG(H3),
+  TAG(H4),
+  TAG(H5),
+  TAG(H6),
+  TAG(HEAD),
+  TAG(HEADER),
+  TAG(HGROUP),
+  TAG(HR),
+  TAG(HTML),
+  TAG(I),
+  TAG(IFRAME),
+  TAG(IMAGE),
+  TAG(IMG),
+  TAG(INPUT),
+  TAG(INS),
+  TAG(ISINDEX),
+  TAG(KBD),
+  TAG(KEYGEN),
+  TAG(LABEL),
+  TAG(LEGEND),
+  TAG(LI),
+  TAG(LINK),
+  TAG(MAIN),
+  TAG(MAP),
+  TAG(MARK),
+  TAG(MATH),
+  TAG(MENU),
+  TAG(MENUITEM),
+  TAG(META),
+  TAG(METER),
+  TAG(NAV),
+  TAG(NEXTID),
+  TAG(NOSCRIPT),
+  TAG(OBJECT),
+  TAG(OL),
+  TAG(OPTGROUP),
+  TAG(OPTION),
+  TAG(OUTPUT),
+  TAG(P),
+  TAG(PARAM),
+  TAG(PICTURE),
+  TAG(PRE),
+  TAG(PROGRESS),
+  TAG(Q),
+  TAG(RB),
+  TAG(RP),
+  TAG(RT),
+  TAG(RTC),
+  TAG(RUBY),
+  TAG(S),
+  TAG(SAMP),
+  TAG(SCRIPT),
+  TAG(SECTION),
+  TAG(SELECT),
+  TAG(SLOT),
+  TAG(SMALL),
+  TAG(SOURCE),
+  TAG(SPAN),
+  TAG(STRONG),
+  TAG(STYLE),
+  TAG(SUB),
+  TAG(SUMMARY),
+  TAG(SUP),
+  TAG(SVG),
+  TAG(TABLE),
+  TAG(TBODY),
+  TAG(TD),
+  TAG(TEMPLATE),
+  TAG(TEXTAREA),
+  TAG(TFOOT),
+  TAG(TH),
+  TAG(THEAD),
+  TAG(TIME),
+  TAG(TITLE),
+  TAG(TR),
+  TAG(TRACK),
+  TAG(U),
+  TAG(UL),
+  TAG(VAR),
+  TAG(VIDEO),
+  TAG(WBR),
 #undef TAG
-  return result;
+};
+
+static constexpr size_t TAG_NAME_COUNT = sizeof(TAG_NAMES) / sizeof(TagName);
+
+static constexpr bool tag_name_less(const char *a, const char *b) {
+  return *a == *b ? *a != 0 && tag_name_less(a + 1, b + 1) : *a < *b;
+}
+
+static constexpr bool tag_names_sorted(size_t i = 0) {
+  return i + 1 >= TAG_NAME_COUNT ||
+    (tag_name_less(TAG_NAMES[i].name, TAG_NAMES[i + 1].name) && tag_names_sorted(i + 1));
+}
+
+static_assert(tag_names_sorted(), "TAG_NAMES must be sorted by name");
+
+static constexpr size_t tag_name_length(const char *name) {
+  return *name ? 1 + tag_name_length(name + 1) : 0;
+}
+
+// No HTML tag name is longer than BLOCKQUOTE or FIGCAPTION, so longer names
+// are custom without a search.
+static constexpr size_t MAX_TAG_NAME_LENGTH = 10;
+
+static constexpr bool tag_names_fit(size_t i = 0) {
+  return i == TAG_NAME_COUNT ||
+    (tag_name_length(TAG_NAMES[i].name) <= MAX_TAG_NAME_LENGTH && tag_names_fit(i + 1));
+}
+
+static_assert(tag_names_fit(), "MAX_TAG_NAME_LENGTH is out of date");
+
+// Compares a table entry with a name that is not null-terminated.
+static inline int compare_tag_name(const char *entry, const char *name, size_t length) {
+  int result = strncmp(entry, name, length);
+  if (result != 0) return result;
+  return entry[length] == 0 ? 0 : 1;
 }
 
-static const map<string, TagType> TAG_TYPES_BY_TAG_NAME = get_tag_map();
+static inline bool find_tag_type(const char *name, size_t length, TagType *type) {
+  size_t low = 0, high = TAG_NAME_COUNT;
+  while (low < high) {
+    size_t middle = (low + high) / 2;
+    int comparison = compare_tag_name(TAG_NAMES[middle].name, name, length);
+    if (comparison == 0) {
+      *type = TAG_NAMES[middle].type;
+      return true;
+    }
+    if (comparison < 0) {
+      low = middle + 1;
+    } else {
+      high = middle;
+    }
+  }
+  return false;
+}
 
-static const TagType TAG_TYPES_NOT_ALLOWED_IN_PARAGRAPHS[] = {
+static constexpr TagType TAG_TYPES_NOT_ALLOWED_IN_PARAGRAPHS[] = {
   ADDRESS,
   ARTICLE,
   ASIDE,
@@ -300,7 +359,7 @@ static const TagType TAG_TYPES_NOT_ALLOWED_IN_PARAGRAPHS[] = {
   SECTION,
 };
 
-static const TagType *TAG_TYPES_NOT_ALLOWED_IN_PARAGRAPHS_END = (
+static constexpr const TagType *TAG_TYPES_NOT_ALLOWED_IN_PARAGRAPHS_END = (
   TAG_TYPES_NOT_ALLOWED_IN_PARAGRAPHS +
   sizeof(TAG_TYPES_NOT_ALLOWED_IN_PARAGRAPHS) /
   sizeof(TagType)
@@ -308,22 +367,21 @@ static const TagType *TAG_TYPES_NOT_ALLOWED_IN_PARAGRAPHS_END = (
 
 struct Tag {
   TagType type;
-  string custom_tag_name;
+
+  // Custom tag names live in the scanner's name arena. Tags are only pushed
+  // and popped, so each name starts where the previous custom tag's ends.
+  uint32_t name_offset;
+  uint32_t name_length;
 
   // This default constructor is used in the case where there is not enough space
   // in the serialization buffer to store all of the tags. In that case, tags
   // that cannot be serialized will be treated as having an unknown type. These
   // tags will be closed via implicit end tags regardless of the next closing
   // tag is encountered.
-  Tag() : type(END_OF_VOID_TAGS) {}
+  Tag() : type(END_OF_VOID_TAGS), name_offset(0), name_length(0) {}
 
-  Tag(TagType type, const string &name) : type(type), custom_tag_name(name) {}
-
-  bool operator==(const Tag &other) const {
-    if (type != other.type) return false;
-    if (type == CUSTOM && custom_tag_name != other.custom_tag_name) return false;
-    return true;
-  }
+  Tag(TagType type, uint32_t name_offset, uint32_t name_length)
+    : type(type), name_offset(name_offset), name_length(name_length) {}
 
   inline bool is_void() const {
     return type < END_OF_VOID_TAGS;
@@ -340,11 +398,11 @@ struct Tag {
         return child != DT && child != DD;
 
       case P:
-        return std::find(
-          TAG_TYPES_NOT_ALLOWED_IN_PARAGRAPHS,
-          TAG_TYPES_NOT_ALLOWED_IN_PARAGRAPHS_END,
-          tag.type
-        ) == TAG_TYPES_NOT_ALLOWED_IN_PARAGRAPHS_END;
+        for (const TagType *type = TAG_TYPES_NOT_ALLOWED_IN_PARAGRAPHS;
+             type != TAG_TYPES_NOT_ALLOWED_IN_PARAGRAPHS_END; type++) {
+          if (*type == child) return false;
+        }
+        return true;
 
       case COLGROUP:
         return child == COL;
@@ -369,12 +427,11 @@ struct Tag {
     }
   }
 
-  static inline Tag for_name(const string &name) {
-    map<string, TagType>::const_iterator type = TAG_TYPES_BY_TAG_NAME.find(name);
-    if (type != TAG_TYPES_BY_TAG_NAME.end()) {
-      return Tag(type->second, string());
-    } else {
-      return Tag(CUSTOM, name);
-    }
+  static inline TagType type_for_name(const char *name, uint32_t length) {
+    TagType type;
+    if (length <= MAX_TAG_NAME_LENGTH && find_tag_type(name, length, &type)) return type;
+    return CUSTOM;
   }
 };
+
+}
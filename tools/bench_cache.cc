@@ -0,0 +1,170 @@
+// Parse-cache benchmark: how much of a run the cache saves, and how often it
+// hits.
+//
+//   bench-cache [-n ITERATIONS] [--cache FILE] [--changed FRACTION]
+//               [--lang blade|strict] [--ext .blade.php] PATH...
+//
+// Processes the files three ways on one thread, the way blade-parse --cache
+// does: hash the contents, look them up, and parse, flatten and extract the
+// references of the misses.
+//
+//   cold     no cache file; every file is parsed, then the cache is saved
+//   warm     the cache saved by the cold run, with every file unchanged
+//   changed  the same cache after editing --changed (default 0.1) of the
+//            files in memory, so that those miss and are parsed again
+//
+// Every run includes loading and saving the cache file (warm and changed runs
+// save to FILE.out, so that each iteration starts from the same cache). Each
+// run is repeated ITERATIONS times (default 5) and the median is reported.
+
+#include "common.h"
+#include "parse_cache.h"
+#include "template_index.h"
+
+#include <unistd.h>
+
+using namespace tools;
+
+namespace {
+
+struct RunResult {
+  size_t hits = 0;
+  size_t nodes = 0;
+  double ms = 0;
+};
+
+RunResult run(TSParser *parser, const ReferenceExtractor &extractor, const vector<SourceFile> &files,
+              uint64_t fingerprint, const string &load_path, const string &save_path) {
+  RunResult result;
+  ParseResult parsed;
+  uint64_t start = now_ns();
+
+  ParseCache cache(fingerprint);
+  cache.load(load_path);
+  for (const SourceFile &file : files) {
+    uint32_t length = file.contents.size();
+    uint64_t hash = hash_bytes(file.contents.data(), length);
+    CachedResult cached;
+    if (cache.find(hash, file.contents.data(), length, &cached)) {
+      result.hits++;
+      result.nodes += cached.node_count;
+      continue;
+    }
+    TSTree *tree = ts_parser_parse_string(parser, NULL, file.contents.data(), length);
+    flatten_tree(ts_tree_root_node(tree), &parsed);
+    extractor.extract(ts_tree_root_node(tree), file.contents, &parsed.references);
+    ts_tree_delete(tree);
+    cache.add(hash, file.contents.data(), length, parsed);
+    result.nodes += parsed.nodes.size();
+  }
+  if (!cache.save(save_path)) {
+    fprintf(stderr, "could not write %s\n", save_path.c_str());
+    exit(1);
+  }
+
+  result.ms = (now_ns() - start) / 1e6;
+  return result;
+}
+
+RunResult median_run(TSParser *parser, const ReferenceExtractor &extractor, const vector<SourceFile> &files,
+                     uint64_t fingerprint, const string &load_path, const string &save_path,
+                     unsigned iterations) {
+  vector<RunResult> results;
+  for (unsigned i = 0; i < iterations; i++) {
+    if (load_path == save_path) unlink(save_path.c_str());
+    results.push_back(run(parser, extractor, files, fingerprint, load_path, save_path));
+  }
+  std::sort(results.begin(), results.end(), [](const RunResult &a, const RunResult &b) { return a.ms < b.ms; });
+  return results[results.size() / 2];
+}
+
+void print_run(const char *name, const RunResult &result, size_t file_count, double cold_ms) {
+  printf("%-10s %8zu %8zu %8.1f%% %10.2f %10.1f %8.1fx\n", name, file_count, result.hits,
+         file_count ? 100.0 * result.hits / file_count : 0.0, result.ms,
+         file_count ? result.ms * 1e3 / file_count : 0.0, result.ms > 0 ? cold_ms / result.ms : 0.0);
+}
+
+void usage() {
+  fprintf(stderr,
+    "usage: bench-cache [-n ITERATIONS] [--cache FILE] [--changed FRACTION]\n"
+    "                   [--lang blade|strict] [--ext EXTENSION] PATH...\n");
+  exit(1);
+}
+
+}
+
+int main(int argc, char **argv) {
+  unsigned iterations = 5;
+  string cache_path = "bench-cache.bin";
+  double changed_fraction = 0.1;
+  string language_name = "blade";
+  string extension = ".blade.php";
+  vector<string> paths;
+
+  for (int i = 1; i < argc; i++) {
+    string arg = argv[i];
+    if ((arg == "-n" || arg == "--iterations") && i + 1 < argc) {
+      iterations = atoi(argv[++i]);
+    } else if (arg == "--cache" && i + 1 < argc) {
+      cache_path = argv[++i];
+    } else if (arg == "--changed" && i + 1 < argc) {
+      changed_fraction = atof(argv[++i]);
+    } else if (arg == "--lang" && i + 1 < argc) {
+      language_name = argv[++i];
+    } else if (arg == "--ext" && i + 1 < argc) {
+      extension = argv[++i];
+    } else if (arg[0] == '-') {
+      usage();
+    } else {
+      paths.push_back(arg);
+    }
+  }
+  if (paths.empty() || iterations == 0) usage();
+  if (language_name != "blade" && language_name != "strict") usage();
+
+  vector<SourceFile> files = load_files(paths, extension);
+  if (files.empty()) {
+    fprintf(stderr, "no input files\n");
+    return 1;
+  }
+
+  const TSLanguage *language = language_for_name(language_name);
+  uint64_t fingerprint = grammar_fingerprint(language, language_name);
+  TSParser *parser = ts_parser_new();
+  ts_parser_set_language(parser, language);
+  ReferenceExtractor extractor(language);
+  string scratch_path = cache_path + ".out";
+
+  RunResult cold = median_run(parser, extractor, files, fingerprint, cache_path, cache_path, iterations);
+  RunResult warm = median_run(parser, extractor, files, fingerprint, cache_path, scratch_path, iterations);
+
+  // Spread the edits evenly over the (sorted) file list.
+  vector<SourceFile> changed_files = files;
+  size_t changed = 0;
+  for (size_t i = 0; i < changed_files.size(); i++) {
+    if (size_t((i + 1) * changed_fraction) != size_t(i * changed_fraction)) {
+      changed_files[i].contents += "\n";
+      changed++;
+    }
+  }
+  RunResult partial = median_run(parser, extractor, changed_files, fingerprint, cache_path, scratch_path,
+                                 iterations);
+
+  size_t total_bytes = 0;
+  for (const SourceFile &file : files) total_bytes += file.contents.size();
+  std::error_code error;
+  uintmax_t cache_bytes = std::filesystem::file_size(cache_path, error);
+
+  printf("%zu files, %s, %zu nodes; %zu changed for the changed run\n\n", files.size(),
+         format_bytes(total_bytes).c_str(), cold.nodes, changed);
+  printf("%-10s %8s %8s %9s %10s %10s %9s\n", "run", "files", "hits", "hit rate", "ms", "us/file", "speedup");
+  print_run("cold", cold, files.size(), cold.ms);
+  print_run("warm", warm, files.size(), cold.ms);
+  print_run("changed", partial, files.size(), cold.ms);
+  printf("\ncache file: %s (%.2f bytes per source byte)\n", format_bytes(error ? 0 : cache_bytes).c_str(),
+         error ? 0.0 : double(cache_bytes) / std::max<size_t>(total_bytes, 1));
+
+  ts_parser_delete(parser);
+  unlink(scratch_path.c_str());
+  return 0;
+}
@@ -0,0 +1,126 @@
+// Parser churn benchmark: the cost of creating a parser, parsing one small
+// template and deleting the parser again, as request-scoped hosts do.
+//
+//   bench-churn [-n CYCLES] [-t THREADS] [--no-pool] [--ext .blade.php] [PATH...]
+//
+// Every cycle runs ts_parser_new, ts_parser_set_language, one parse of the
+// next template and both deletes. Without paths, a few built-in templates are
+// used. The scanner pool (see src/scanner_pool.h) is only there when the
+// tools are built with `make POOL_SIZE=N`; --no-pool then empties it after
+// every cycle, which gives the cost of allocating a fresh scanner each time.
+// Reports cycles per second, per-cycle latency percentiles and runtime
+// allocations per cycle.
+
+#include "common.h"
+#include "scanner_pool.h"
+
+#include <thread>
+
+using namespace tools;
+
+namespace {
+
+const char *const DEFAULT_TEMPLATES[] = {
+  "<x-alert type=\"success\">{{ $message }}</x-alert>\n",
+  "@if ($user)\n  <span class=\"name\">{{ $user->name }}</span>\n@endif\n",
+  "<ul>\n@foreach ($items as $item)\n  <li>{{ $item }}</li>\n@endforeach\n</ul>\n",
+  "<button wire:click=\"save\" {{ $attributes->merge(['class' => 'btn']) }}>{!! $label !!}</button>\n",
+};
+
+struct ThreadResult {
+  vector<double> latencies;
+};
+
+void run_cycles(const vector<SourceFile> *templates, unsigned cycles, bool pool, ThreadResult *result) {
+  result->latencies.reserve(cycles);
+  for (unsigned i = 0; i < cycles; i++) {
+    const string &source = (*templates)[i % templates->size()].contents;
+    uint64_t start = now_ns();
+    TSParser *parser = ts_parser_new();
+    ts_parser_set_language(parser, tree_sitter_blade());
+    TSTree *tree = ts_parser_parse_string(parser, NULL, source.data(), source.size());
+    ts_tree_delete(tree);
+    ts_parser_delete(parser);
+    if (!pool) tree_sitter_blade_scanner_pool_clear();
+    result->latencies.push_back((now_ns() - start) / 1e3);
+  }
+  tree_sitter_blade_scanner_pool_clear();
+}
+
+void usage() {
+  fprintf(stderr, "usage: bench-churn [-n CYCLES] [-t THREADS] [--no-pool] [--ext EXTENSION] [PATH...]\n");
+  exit(1);
+}
+
+}
+
+int main(int argc, char **argv) {
+  unsigned cycles = 100000;
+  unsigned thread_count = 1;
+  bool pool = true;
+  string extension = ".blade.php";
+  vector<string> paths;
+
+  for (int i = 1; i < argc; i++) {
+    string arg = argv[i];
+    if ((arg == "-n" || arg == "--cycles") && i + 1 < argc) {
+      cycles = atoi(argv[++i]);
+    } else if ((arg == "-t" || arg == "--threads") && i + 1 < argc) {
+      thread_count = atoi(argv[++i]);
+    } else if (arg == "--no-pool") {
+      pool = false;
+    } else if (arg == "--ext" && i + 1 < argc) {
+      extension = argv[++i];
+    } else if (arg[0] == '-') {
+      usage();
+    } else {
+      paths.push_back(arg);
+    }
+  }
+  if (cycles == 0 || thread_count == 0) usage();
+
+  vector<SourceFile> templates;
+  if (paths.empty()) {
+    for (const char *source : DEFAULT_TEMPLATES) templates.push_back({"(built-in)", source});
+  } else {
+    templates = load_files(paths, extension);
+  }
+  if (templates.empty()) {
+    fprintf(stderr, "no input files\n");
+    return 1;
+  }
+
+  // The counting allocator is not thread-safe, so allocations are only
+  // counted in single-threaded runs.
+  if (thread_count == 1) install_counting_allocator();
+  vector<ThreadResult> results(thread_count);
+  uint64_t start = now_ns();
+  if (thread_count == 1) {
+    run_cycles(&templates, cycles, pool, &results[0]);
+  } else {
+    vector<std::thread> threads;
+    for (unsigned i = 0; i < thread_count; i++) {
+      threads.emplace_back(run_cycles, &templates, cycles, pool, &results[i]);
+    }
+    for (std::thread &thread : threads) thread.join();
+  }
+  double seconds = (now_ns() - start) / 1e9;
+
+  vector<double> latencies;
+  for (const ThreadResult &result : results) {
+    latencies.insert(latencies.end(), result.latencies.begin(), result.latencies.end());
+  }
+
+  printf("scanner pool: %s\n", pool ? "kept between cycles" : "cleared after every cycle");
+  printf("templates:    %zu\n", templates.size());
+  printf("threads:      %u\n", thread_count);
+  printf("cycles:       %u per thread\n", cycles);
+  printf("throughput:   %.0f cycles/s\n", latencies.size() / seconds);
+  printf("latency:      p50 %.2f us, p99 %.2f us\n",
+         percentile(latencies, 0.5), percentile(latencies, 0.99));
+  if (thread_count == 1) {
+    printf("allocations:  %.1f per cycle\n",
+           double(allocation_counters.allocations) / cycles);
+  }
+  return 0;
+}
@@ -0,0 +1,310 @@
+// Incremental reparse latency benchmark.
+//
+//   bench-edit [-v] [--index] --log EDITS FILE
+//   bench-edit [-v] [--index] --synthetic FILE...
+//
+// Replays a sequence of edits through `ts_tree_edit` and an incremental
+// reparse, and reports for each edit the reparse time, the total size of the
+// ranges returned by `ts_tree_get_changed_ranges` and how many times the
+// external scanner was serialized and deserialized.
+//
+// An edit log has one edit per line: `OFFSET DELETED_BYTES TEXT`, where TEXT
+// is inserted after deleting and may use \n, \t and \\ escapes. `--synthetic`
+// instead builds a session per file that types `{{ $value }}` into markup,
+// types a statement inside the first <script> and deletes and restores the
+// first `</div>`, one keystroke at a time.
+//
+// With `--index`, the template's references (see template_index.h) are also
+// kept up to date after each edit with TemplateReferences::update, which
+// only looks again around the changed ranges, and extracted from the whole
+// new tree for comparison; the two results must agree. Synthetic sessions
+// then also type an `@include` directive. The difference shows on large
+// templates:
+//
+//   gen-corpus --files 20 --size 256K --out /tmp/large
+//   bench-edit --index --synthetic /tmp/large
+
+#include "common.h"
+#include "template_index.h"
+
+using namespace tools;
+
+namespace {
+
+struct Edit {
+  uint32_t offset;
+  uint32_t deleted;
+  string inserted;
+};
+
+struct EditResult {
+  double ms;
+  uint64_t changed_bytes;
+  uint32_t changed_ranges;
+  uint64_t serializations;
+  uint64_t deserializations;
+  double update_ms;
+  double extract_ms;
+  uint32_t rescanned_bytes;
+};
+
+TSPoint point_at(const string &text, uint32_t offset) {
+  TSPoint point = {0, 0};
+  for (uint32_t i = 0; i < offset && i < text.size(); i++) {
+    if (text[i] == '\n') {
+      point.row++;
+      point.column = 0;
+    } else {
+      point.column++;
+    }
+  }
+  return point;
+}
+
+string unescape(const string &text) {
+  string result;
+  for (size_t i = 0; i < text.size(); i++) {
+    if (text[i] == '\\' && i + 1 < text.size()) {
+      char c = text[++i];
+      result += c == 'n' ? '\n' : c == 't' ? '\t' : c;
+    } else {
+      result += text[i];
+    }
+  }
+  return result;
+}
+
+bool load_edit_log(const string &path, vector<Edit> *edits) {
+  std::ifstream log(path);
+  if (!log) return false;
+  string line;
+  while (std::getline(log, line)) {
+    if (line.empty() || line[0] == '#') continue;
+    std::istringstream fields(line);
+    Edit edit;
+    fields >> edit.offset >> edit.deleted;
+    if (fields.peek() == ' ') fields.get();
+    std::getline(fields, edit.inserted);
+    edit.inserted = unescape(edit.inserted);
+    edits->push_back(edit);
+  }
+  return true;
+}
+
+void type_text(vector<Edit> *edits, uint32_t offset, const string &text) {
+  for (size_t i = 0; i < text.size(); i++) {
+    edits->push_back(Edit{static_cast<uint32_t>(offset + i), 0, text.substr(i, 1)});
+  }
+}
+
+vector<Edit> synthetic_session(const string &text, bool directives) {
+  vector<Edit> edits;
+
+  // Each step is applied to the text produced by the previous ones, so keep
+  // track of how far later offsets have shifted.
+  size_t markup = text.find(">\n");
+  size_t script = text.find("<script");
+  if (script != string::npos) script = text.find('>', script);
+  size_t div = text.find("</div>");
+
+  int64_t shift = 0;
+  struct Site { size_t offset; int kind; };
+  vector<Site> sites;
+  if (markup != string::npos) sites.push_back({markup + 2, 0});
+  if (script != string::npos) sites.push_back({script + 1, 1});
+  if (div != string::npos) sites.push_back({div, 2});
+  if (directives && markup != string::npos) {
+    size_t line = text.find('\n', text.size() / 2);
+    if (line != string::npos) sites.push_back({line + 1, 3});
+  }
+  std::sort(sites.begin(), sites.end(), [](const Site &a, const Site &b) { return a.offset < b.offset; });
+
+  for (const Site &site : sites) {
+    uint32_t offset = static_cast<uint32_t>(site.offset + shift);
+    switch (site.kind) {
+      case 0:
+        type_text(&edits, offset, "{{ $value }}");
+        shift += 12;
+        break;
+      case 1:
+        type_text(&edits, offset, "let total = 0;");
+        shift += 14;
+        break;
+      case 2:
+        // Backspace from the end of the tag, then type it again.
+        for (uint32_t i = 6; i > 0; i--) edits.push_back(Edit{offset + i - 1, 1, ""});
+        type_text(&edits, offset, "</div>");
+        break;
+      case 3:
+        type_text(&edits, offset, "@include('partials.extra')\n");
+        shift += 27;
+        break;
+    }
+  }
+  return edits;
+}
+
+bool same_references(const vector<Reference> &a, const vector<Reference> &b) {
+  if (a.size() != b.size()) return false;
+  for (size_t i = 0; i < a.size(); i++) {
+    if (a[i].kind != b[i].kind || a[i].start_byte != b[i].start_byte || a[i].name != b[i].name) return false;
+  }
+  return true;
+}
+
+vector<EditResult> replay(TSParser *parser, const ReferenceExtractor *extractor, const string &path,
+                          string text, const vector<Edit> &edits) {
+  vector<EditResult> results;
+  TSTree *tree = ts_parser_parse_string(parser, NULL, text.data(), text.size());
+  TemplateReferences references(extractor);
+  vector<Reference> extracted;
+  if (extractor) references.reset(tree, text);
+
+  for (const Edit &edit : edits) {
+    if (edit.offset > text.size()) break;
+    uint32_t deleted = std::min<uint32_t>(edit.deleted, text.size() - edit.offset);
+
+    TSInputEdit input_edit;
+    input_edit.start_byte = edit.offset;
+    input_edit.old_end_byte = edit.offset + deleted;
+    input_edit.new_end_byte = edit.offset + edit.inserted.size();
+    input_edit.start_point = point_at(text, input_edit.start_byte);
+    input_edit.old_end_point = point_at(text, input_edit.old_end_byte);
+    text.replace(edit.offset, deleted, edit.inserted);
+    input_edit.new_end_point = point_at(text, input_edit.new_end_byte);
+
+    ts_tree_edit(tree, &input_edit);
+    if (extractor) references.edit(input_edit);
+
+    scanner_counters = ScannerCounters();
+    uint64_t start = now_ns();
+    TSTree *new_tree = ts_parser_parse_string(parser, tree, text.data(), text.size());
+    uint64_t elapsed = now_ns() - start;
+
+    EditResult result = {elapsed / 1e6, 0, 0,
+                         scanner_counters.serializations,
+                         scanner_counters.deserializations, 0, 0, 0};
+    TSRange *ranges = ts_tree_get_changed_ranges(tree, new_tree, &result.changed_ranges);
+    for (uint32_t i = 0; i < result.changed_ranges; i++) {
+      result.changed_bytes += ranges[i].end_byte - ranges[i].start_byte;
+    }
+    free(ranges);
+
+    if (extractor) {
+      start = now_ns();
+      result.rescanned_bytes = references.update(tree, new_tree, text);
+      result.update_ms = (now_ns() - start) / 1e6;
+      extracted.clear();
+      start = now_ns();
+      extractor->extract(ts_tree_root_node(new_tree), text, &extracted);
+      result.extract_ms = (now_ns() - start) / 1e6;
+      if (!same_references(references.references(), extracted)) {
+        fprintf(stderr, "%s: edit %zu: updated references differ from a full extraction\n",
+                path.c_str(), results.size());
+        exit(1);
+      }
+    }
+    results.push_back(result);
+
+    ts_tree_delete(tree);
+    tree = new_tree;
+  }
+
+  ts_tree_delete(tree);
+  return results;
+}
+
+void usage() {
+  fprintf(stderr,
+    "usage: bench-edit [-v] [--index] --log EDITS FILE\n"
+    "       bench-edit [-v] [--index] --synthetic FILE...\n");
+  exit(1);
+}
+
+}
+
+int main(int argc, char **argv) {
+  bool verbose = false, synthetic = false, index = false;
+  string log_path;
+  vector<string> paths;
+
+  for (int i = 1; i < argc; i++) {
+    string arg = argv[i];
+    if (arg == "-v") {
+      verbose = true;
+    } else if (arg == "--index") {
+      index = true;
+    } else if (arg == "--synthetic") {
+      synthetic = true;
+    } else if (arg == "--log" && i + 1 < argc) {
+      log_path = argv[++i];
+    } else if (arg[0] == '-') {
+      usage();
+    } else {
+      paths.push_back(arg);
+    }
+  }
+  if (paths.empty() || synthetic == !log_path.empty()) usage();
+
+  vector<Edit> logged_edits;
+  if (!log_path.empty() && !load_edit_log(log_path, &logged_edits)) {
+    fprintf(stderr, "could not read %s\n", log_path.c_str());
+    return 1;
+  }
+
+  TSParser *parser = ts_parser_new();
+  ts_parser_set_language(parser, instrument_scanner());
+  ReferenceExtractor extractor(ts_parser_language(parser));
+
+  vector<double> latencies, update_latencies, extract_latencies;
+  uint64_t changed_bytes = 0, serializations = 0, deserializations = 0, rescanned_bytes = 0;
+
+  if (verbose) printf("%-40s %6s %10s %10s %8s %8s\n", "file", "edit", "ms", "changed", "ser", "deser");
+  for (const SourceFile &file : load_files(paths)) {
+    vector<Edit> edits = synthetic ? synthetic_session(file.contents, index) : logged_edits;
+    vector<EditResult> results = replay(parser, index ? &extractor : NULL, file.path, file.contents, edits);
+    for (size_t i = 0; i < results.size(); i++) {
+      const EditResult &result = results[i];
+      latencies.push_back(result.ms);
+      changed_bytes += result.changed_bytes;
+      serializations += result.serializations;
+      deserializations += result.deserializations;
+      if (index) {
+        update_latencies.push_back(result.update_ms);
+        extract_latencies.push_back(result.extract_ms);
+        rescanned_bytes += result.rescanned_bytes;
+      }
+      if (verbose) {
+        printf("%-40s %6zu %10.3f %10llu %8llu %8llu\n", file.path.c_str(), i, result.ms,
+               (unsigned long long)result.changed_bytes,
+               (unsigned long long)result.serializations,
+               (unsigned long long)result.deserializations);
+      }
+    }
+  }
+
+  ts_parser_delete(parser);
+
+  size_t count = latencies.size();
+  if (!count) {
+    fprintf(stderr, "no edits were applied\n");
+    return 1;
+  }
+  if (verbose) printf("\n");
+  printf("edits:           %zu\n", count);
+  // `percentile` sorts, so take the percentiles before reading the maximum.
+  double p50 = percentile(latencies, 0.5), p99 = percentile(latencies, 0.99);
+  printf("reparse:         p50 %.3f ms, p99 %.3f ms, max %.3f ms\n", p50, p99, latencies.back());
+  printf("changed ranges:  %.1f bytes per edit\n", static_cast<double>(changed_bytes) / count);
+  printf("serialize:       %.1f calls per edit\n", static_cast<double>(serializations) / count);
+  printf("deserialize:     %.1f calls per edit\n", static_cast<double>(deserializations) / count);
+  if (index) {
+    double update_p50 = percentile(update_latencies, 0.5), update_p99 = percentile(update_latencies, 0.99);
+    printf("index update:    p50 %.3f ms, p99 %.3f ms, max %.3f ms, %.1f bytes rescanned per edit\n",
+           update_p50, update_p99, update_latencies.back(), static_cast<double>(rescanned_bytes) / count);
+    double extract_p50 = percentile(extract_latencies, 0.5), extract_p99 = percentile(extract_latencies, 0.99);
+    printf("full extract:    p50 %.3f ms, p99 %.3f ms, max %.3f ms\n",
+           extract_p50, extract_p99, extract_latencies.back());
+  }
+  return 0;
+}
@@ -0,0 +1,198 @@
+// Template index benchmark: finding the references of every template in a
+// project and building the dependency index over them (see template_index.h).
+//
+//   bench-index [-j THREADS] [--ext .blade.php] [--query NAME]... PATH...
+//
+// Each PATH is a views directory (like resources/views) and view names are
+// relative to it. For a project of realistic size, generate one first:
+//
+//   gen-corpus --files 50000 --size 2K --component-ratio 0.3 --out /tmp/views
+//   bench-index /tmp/views
+//
+// Templates are parsed on THREADS threads (default: all cores). Reported:
+//
+//   parse    wall time of parsing all templates
+//   extract  time spent finding references in the trees, summed over threads
+//   build    interning the names and building both directions of the index
+//   lookup   find_name plus referrers for every name, per lookup
+//   impact   dependents() of the ten most referenced views, per call
+//
+// along with the references per kind and the size of the index. --query
+// prints what references NAME and, if NAME is an indexed template, what it
+// references and which templates depend on it.
+
+#include "common.h"
+#include "template_index.h"
+
+#include <atomic>
+#include <thread>
+
+using namespace tools;
+
+namespace {
+
+struct Template {
+  string view_name;
+  string contents;
+  vector<Reference> references;
+};
+
+struct Timing {
+  uint64_t parse_ns = 0;
+  uint64_t extract_ns = 0;
+};
+
+void extract_all(vector<Template> *templates, std::atomic<size_t> *next, Timing *timing) {
+  TSParser *parser = ts_parser_new();
+  ts_parser_set_language(parser, tree_sitter_blade());
+  ReferenceExtractor extractor(tree_sitter_blade());
+  for (size_t i; (i = next->fetch_add(1)) < templates->size();) {
+    Template &t = (*templates)[i];
+    uint64_t start = now_ns();
+    TSTree *tree = ts_parser_parse_string(parser, NULL, t.contents.data(), t.contents.size());
+    uint64_t parsed = now_ns();
+    extractor.extract(ts_tree_root_node(tree), t.contents, &t.references);
+    timing->extract_ns += now_ns() - parsed;
+    timing->parse_ns += parsed - start;
+    ts_tree_delete(tree);
+  }
+  ts_parser_delete(parser);
+}
+
+void print_query(const TemplateIndex &index, const string &query) {
+  printf("\n%s\n", query.c_str());
+  uint32_t name = index.find_name(query);
+  if (name == TemplateIndex::NONE) {
+    printf("  not referenced or defined anywhere\n");
+    return;
+  }
+  for (const TemplateIndex::Referrer &referrer : index.referrers(name)) {
+    printf("  %-10s from %s\n", REFERENCE_KIND_NAMES[referrer.kind],
+           string(index.name(index.template_name(referrer.template_id))).c_str());
+  }
+  uint32_t template_id = index.template_for_name(name);
+  if (template_id == TemplateIndex::NONE) return;
+  for (const TemplateIndex::Edge &edge : index.references(template_id)) {
+    printf("  %-10s to   %s\n", REFERENCE_KIND_NAMES[edge.kind], string(index.name(edge.name)).c_str());
+  }
+  printf("  %zu dependent templates\n", index.dependents(name).size());
+}
+
+void usage() {
+  fprintf(stderr, "usage: bench-index [-j THREADS] [--ext EXTENSION] [--query NAME]... PATH...\n");
+  exit(1);
+}
+
+}
+
+int main(int argc, char **argv) {
+  unsigned thread_count = 0;
+  string extension = ".blade.php";
+  vector<string> queries;
+  vector<string> paths;
+
+  for (int i = 1; i < argc; i++) {
+    string arg = argv[i];
+    if ((arg == "-j" || arg == "--threads") && i + 1 < argc) {
+      thread_count = atoi(argv[++i]);
+    } else if (arg == "--ext" && i + 1 < argc) {
+      extension = argv[++i];
+    } else if (arg == "--query" && i + 1 < argc) {
+      queries.push_back(argv[++i]);
+    } else if (arg[0] == '-') {
+      usage();
+    } else {
+      paths.push_back(arg);
+    }
+  }
+  if (paths.empty()) usage();
+  if (thread_count == 0) thread_count = std::max(1u, std::thread::hardware_concurrency());
+
+  vector<Template> templates;
+  size_t total_bytes = 0;
+  for (const string &root : paths) {
+    for (SourceFile &file : load_files({root}, extension)) {
+      total_bytes += file.contents.size();
+      templates.push_back(Template{view_name_for_path(file.path, root, extension), std::move(file.contents), {}});
+    }
+  }
+  if (templates.empty()) {
+    fprintf(stderr, "no input files\n");
+    return 1;
+  }
+
+  std::atomic<size_t> next(0);
+  vector<Timing> timings(thread_count);
+  uint64_t start = now_ns();
+  vector<std::thread> threads;
+  for (unsigned i = 0; i < thread_count; i++) {
+    threads.emplace_back(extract_all, &templates, &next, &timings[i]);
+  }
+  for (std::thread &thread : threads) thread.join();
+  uint64_t wall_ns = now_ns() - start;
+  Timing total;
+  for (const Timing &timing : timings) {
+    total.parse_ns += timing.parse_ns;
+    total.extract_ns += timing.extract_ns;
+  }
+
+  size_t kind_counts[REFERENCE_KIND_COUNT] = {};
+  size_t reference_count = 0;
+  for (const Template &t : templates) {
+    for (const Reference &reference : t.references) kind_counts[reference.kind]++;
+    reference_count += t.references.size();
+  }
+
+  start = now_ns();
+  TemplateIndexBuilder builder;
+  for (const Template &t : templates) builder.add_template(t.view_name, t.references);
+  TemplateIndex index = builder.build();
+  uint64_t build_ns = now_ns() - start;
+
+  // Every name, looked up by string as a caller would.
+  vector<string> names;
+  for (uint32_t i = 0; i < index.name_count(); i++) names.push_back(string(index.name(i)));
+  size_t referrer_total = 0;
+  start = now_ns();
+  for (const string &name : names) referrer_total += index.referrers(index.find_name(name)).size();
+  uint64_t lookup_ns = now_ns() - start;
+
+  vector<uint32_t> by_referrers(index.name_count());
+  for (uint32_t i = 0; i < by_referrers.size(); i++) by_referrers[i] = i;
+  std::sort(by_referrers.begin(), by_referrers.end(), [&](uint32_t a, uint32_t b) {
+    return index.referrers(a).size() > index.referrers(b).size();
+  });
+  size_t impact_calls = 0, dependent_total = 0;
+  start = now_ns();
+  for (uint32_t name : by_referrers) {
+    if (impact_calls == 10) break;
+    bool is_view = false;
+    for (const TemplateIndex::Referrer &referrer : index.referrers(name)) is_view |= names_view(referrer.kind);
+    if (!is_view) continue;
+    dependent_total += index.dependents(name).size();
+    impact_calls++;
+  }
+  uint64_t impact_ns = now_ns() - start;
+
+  printf("%zu templates, %s, %u threads\n", templates.size(), format_bytes(total_bytes).c_str(), thread_count);
+  printf("%zu references, %zu distinct edges, %zu names\n", reference_count, index.edge_count(), index.name_count());
+  for (unsigned kind = 0; kind < REFERENCE_KIND_COUNT; kind++) {
+    printf("  %-10s %10zu\n", REFERENCE_KIND_NAMES[kind], kind_counts[kind]);
+  }
+  printf("\n");
+  printf("parse      %10.1f ms wall, %8.1f us per template (thread time)\n",
+         wall_ns / 1e6, total.parse_ns / 1e3 / templates.size());
+  printf("extract    %10.1f ms total, %8.1f us per template, %.1f%% of parse\n",
+         total.extract_ns / 1e6, total.extract_ns / 1e3 / templates.size(),
+         total.parse_ns ? 100.0 * total.extract_ns / total.parse_ns : 0.0);
+  printf("build      %10.1f ms\n", build_ns / 1e6);
+  printf("lookup     %10.1f ns per name (%zu referrers)\n",
+         names.empty() ? 0.0 : double(lookup_ns) / names.size(), referrer_total);
+  printf("impact     %10.1f us per call (%zu dependents over %zu views)\n",
+         impact_calls ? impact_ns / 1e3 / impact_calls : 0.0, dependent_total, impact_calls);
+  printf("index      %s (%.1f bytes per edge)\n", format_bytes(index.memory_bytes()).c_str(),
+         index.edge_count() ? double(index.memory_bytes()) / index.edge_count() : 0.0);
+
+  for (const string &query : queries) print_query(index, query);
+  return 0;
+}
@@ -0,0 +1,169 @@
+// Large-file input benchmark: parsing a file read into a string, against
+// parsing it straight from the file through FileInput (file_input.h).
+//
+//   bench-input [-n ITERATIONS] [--chunk BYTES] FILE...
+//
+// Each file is parsed three ways, each in a child process of its own so that
+// their memory use can be told apart:
+//
+//   string   read_file into a std::string, then ts_parser_parse_string
+//   mmap     FileInput over the mapped file
+//   pread    FileInput reading --chunk bytes (default 64K) at a time
+//
+// Reported per way: the median time of ITERATIONS (default 3) reads and
+// parses, the anonymous memory the child gained, measured while the last
+// tree is still alive (so the tree plus whatever holds the source), the
+// child's peak RSS, and how many bytes were copied to serve the parser. The
+// peak RSS of the mmap run includes the file pages it touched; those are
+// page cache that the kernel can reclaim, not memory of the process.
+//
+//   gen-corpus --size 100M > /tmp/huge.blade.php
+//   bench-input /tmp/huge.blade.php
+
+#include "common.h"
+#include "file_input.h"
+
+#include <sys/wait.h>
+#include <unistd.h>
+
+using namespace tools;
+
+namespace {
+
+enum Mode { STRING_MODE, MMAP_MODE, PREAD_MODE };
+
+const char *const MODE_NAMES[] = {"string", "mmap", "pread"};
+
+struct RunResult {
+  bool ok;
+  double ms;
+  int64_t anon_kb;
+  uint64_t copied_bytes;
+  uint64_t read_count;
+  uint64_t peak_rss_kb;
+};
+
+int64_t anon_kb() {
+  std::ifstream status("/proc/self/status");
+  string line;
+  while (std::getline(status, line)) {
+    if (line.compare(0, 8, "RssAnon:") == 0) return atoll(line.c_str() + 8);
+  }
+  return 0;
+}
+
+RunResult run(const string &path, Mode mode, unsigned iterations, uint32_t chunk_size) {
+  RunResult result = {};
+  int64_t anon_before = anon_kb();
+  TSParser *parser = ts_parser_new();
+  ts_parser_set_language(parser, tree_sitter_blade());
+  vector<double> times;
+  TSTree *tree = NULL;
+  string contents;
+  FileInput input;
+
+  for (unsigned i = 0; i < iterations; i++) {
+    if (tree) ts_tree_delete(tree);
+    contents = string();
+    uint64_t start = now_ns();
+    if (mode == STRING_MODE) {
+      if (!read_file(path, &contents)) return result;
+      tree = ts_parser_parse_string(parser, NULL, contents.data(), contents.size());
+      result.copied_bytes = contents.size();
+      result.read_count = 1;
+    } else {
+      if (!input.open(path, mode == MMAP_MODE, chunk_size)) return result;
+      tree = ts_parser_parse(parser, NULL, input.input());
+      result.copied_bytes = input.copied_bytes();
+      result.read_count = input.read_count();
+    }
+    times.push_back((now_ns() - start) / 1e6);
+  }
+
+  result.ok = true;
+  result.ms = percentile(times, 0.5);
+  result.anon_kb = anon_kb() - anon_before;
+  ts_tree_delete(tree);
+  ts_parser_delete(parser);
+  return result;
+}
+
+// Runs one way in a child process and collects its result and peak RSS.
+RunResult run_in_child(const string &path, Mode mode, unsigned iterations, uint32_t chunk_size) {
+  RunResult result = {};
+  int fds[2];
+  if (pipe(fds) != 0) return result;
+  pid_t pid = fork();
+  if (pid < 0) return result;
+  if (pid == 0) {
+    close(fds[0]);
+    RunResult child = run(path, mode, iterations, chunk_size);
+    ssize_t written = write(fds[1], &child, sizeof(child));
+    _exit(written == sizeof(child) ? 0 : 1);
+  }
+  close(fds[1]);
+  ssize_t length = read(fds[0], &result, sizeof(result));
+  close(fds[0]);
+  int status;
+  struct rusage usage;
+  if (wait4(pid, &status, 0, &usage) != pid || length != sizeof(result) ||
+      !WIFEXITED(status) || WEXITSTATUS(status) != 0) {
+    return RunResult{};
+  }
+  result.peak_rss_kb = usage.ru_maxrss;
+  return result;
+}
+
+void usage() {
+  fprintf(stderr, "usage: bench-input [-n ITERATIONS] [--chunk BYTES] FILE...\n");
+  exit(1);
+}
+
+}
+
+int main(int argc, char **argv) {
+  unsigned iterations = 3;
+  uint32_t chunk_size = FileInput::DEFAULT_CHUNK_SIZE;
+  vector<string> paths;
+
+  for (int i = 1; i < argc; i++) {
+    string arg = argv[i];
+    if ((arg == "-n" || arg == "--iterations") && i + 1 < argc) {
+      iterations = atoi(argv[++i]);
+    } else if (arg == "--chunk" && i + 1 < argc) {
+      chunk_size = atoi(argv[++i]);
+    } else if (arg[0] == '-') {
+      usage();
+    } else {
+      paths.push_back(arg);
+    }
+  }
+  if (paths.empty() || iterations == 0 || chunk_size == 0) usage();
+
+  printf("%-8s %10s %9s %12s %12s %12s %10s\n", "input", "ms", "MB/s", "extra anon", "peak RSS",
+         "copied", "reads");
+  for (const string &path : paths) {
+    FileInput input;
+    if (!input.open(path)) {
+      fprintf(stderr, "could not open %s\n", path.c_str());
+      return 1;
+    }
+    size_t size = input.size();
+    input.close();
+
+    printf("\n%s (%s)\n", path.c_str(), format_bytes(size).c_str());
+    for (Mode mode : {STRING_MODE, MMAP_MODE, PREAD_MODE}) {
+      RunResult result = run_in_child(path, mode, iterations, chunk_size);
+      if (!result.ok) {
+        printf("%-8s failed\n", MODE_NAMES[mode]);
+        continue;
+      }
+      printf("%-8s %10.1f %9.1f %12s %12s %12s %10llu\n", MODE_NAMES[mode], result.ms,
+             result.ms > 0 ? size / 1e3 / result.ms : 0.0,
+             format_bytes(std::max<int64_t>(result.anon_kb, 0) * 1024).c_str(),
+             format_bytes(result.peak_rss_kb * 1024).c_str(),
+             format_bytes(result.copied_bytes).c_str(), (unsigned long long)result.read_count);
+    }
+  }
+  return 0;
+}
@@ -0,0 +1,209 @@
+// Parse throughput benchmark.
+//
+//   bench-parse [-n ITERATIONS] [--lang blade|strict|html|lite] [--ext .blade.php] PATH...
+//   bench-parse --compare-html [-n ITERATIONS] [--ext .html] PATH...
+//   bench-parse --compare-lite [-n ITERATIONS] [--ext .blade.php] PATH...
+//
+// Every file is parsed once as a warm-up and then ITERATIONS more times with a
+// single reused parser. Reports MB/s, nodes/s, per-file latency percentiles
+// and the peak resident set size of the process. When the scanner is built
+// with TREE_SITTER_BLADE_STATS (`make STATS=1`), its counters for the timed
+// iterations are printed as well.
+//
+// --compare-html parses the same corpus with the upstream tree-sitter-html
+// language and with tree_sitter_blade, and reports what the Blade additions
+// cost in throughput and in memory held by the trees. Use an HTML-only corpus
+// so that both grammars build the same trees. html is only linked in with
+// `make HTML=1`.
+//
+// --compare-lite does the same for tree_sitter_blade against the Blade-only
+// grammar in lite/ (`make LITE=1`), which leaves the HTML as text.
+
+#include "common.h"
+#include "scanner_stats.h"
+
+using namespace tools;
+
+namespace {
+
+struct Result {
+  size_t bytes = 0;
+  size_t nodes = 0;
+  size_t error_files = 0;
+  uint64_t ns = 0;
+  int64_t tree_bytes = 0;
+  int64_t peak_bytes = 0;
+  vector<double> latencies;
+
+  double mb_per_second(unsigned iterations) const {
+    return bytes * iterations / (ns / 1e9) / (1024 * 1024);
+  }
+};
+
+Result run(const TSLanguage *language, const vector<SourceFile> &files, unsigned iterations) {
+  Result result;
+  TSParser *parser = ts_parser_new();
+  ts_parser_set_language(parser, language);
+  allocation_counters.peak_bytes = allocation_counters.live_bytes;
+  int64_t baseline_bytes = allocation_counters.live_bytes;
+
+  for (const SourceFile &file : files) {
+    TSTree *tree = ts_parser_parse_string(parser, NULL, file.contents.data(), file.contents.size());
+    TSNode root = ts_tree_root_node(tree);
+    result.bytes += file.contents.size();
+    result.nodes += count_nodes(root);
+    if (ts_node_has_error(root)) result.error_files++;
+    int64_t live_with_tree = allocation_counters.live_bytes;
+    ts_tree_delete(tree);
+    result.tree_bytes += live_with_tree - allocation_counters.live_bytes;
+  }
+
+  tree_sitter_blade_scanner_stats_reset();
+
+  result.latencies.reserve(files.size() * iterations);
+  for (unsigned i = 0; i < iterations; i++) {
+    for (const SourceFile &file : files) {
+      uint64_t start = now_ns();
+      TSTree *tree = ts_parser_parse_string(parser, NULL, file.contents.data(), file.contents.size());
+      uint64_t elapsed = now_ns() - start;
+      ts_tree_delete(tree);
+      result.ns += elapsed;
+      result.latencies.push_back(elapsed / 1e6);
+    }
+  }
+
+  result.peak_bytes = allocation_counters.peak_bytes - baseline_bytes;
+  ts_parser_delete(parser);
+  return result;
+}
+
+void print_result(const string &language_name, Result &result, unsigned iterations, size_t file_count) {
+  double seconds = result.ns / 1e9;
+  printf("language:   %s\n", language_name.c_str());
+  printf("files:      %zu (%zu with errors)\n", file_count, result.error_files);
+  printf("bytes:      %s\n", format_bytes(result.bytes).c_str());
+  printf("iterations: %u\n", iterations);
+  printf("throughput: %.2f MB/s, %.2f Mnodes/s\n",
+         result.mb_per_second(iterations),
+         result.nodes * iterations / seconds / 1e6);
+  printf("latency:    p50 %.3f ms, p99 %.3f ms\n",
+         percentile(result.latencies, 0.5), percentile(result.latencies, 0.99));
+  printf("peak rss:   %.2f MB\n", peak_rss_mb());
+
+  TSBladeScannerStats stats;
+  if (language_name != "html" && language_name != "lite" && tree_sitter_blade_scanner_stats(&stats)) {
+    printf("\nscanner, per iteration:\n");
+    printf("  scan calls:        %llu\n", (unsigned long long)stats.scan_calls / iterations);
+    printf("  bytes advanced:    %llu (+%llu skipped)\n",
+           (unsigned long long)stats.bytes_advanced / iterations,
+           (unsigned long long)stats.bytes_skipped / iterations);
+    printf("  serialize:         %llu calls, %llu bytes\n",
+           (unsigned long long)stats.serialize_calls / iterations,
+           (unsigned long long)stats.serialize_bytes / iterations);
+    printf("  deserialize:       %llu calls, %llu bytes\n",
+           (unsigned long long)stats.deserialize_calls / iterations,
+           (unsigned long long)stats.deserialize_bytes / iterations);
+    printf("  implicit end tags: %llu\n",
+           (unsigned long long)stats.emitted[TS_BLADE_TOKEN_IMPLICIT_END_TAG] / iterations);
+    printf("  custom tags:       %llu\n", (unsigned long long)stats.custom_tags / iterations);
+    printf("  max stack depth:   %llu\n", (unsigned long long)stats.max_stack_depth);
+  }
+}
+
+double delta_percent(double value, double baseline) {
+  return baseline ? (value - baseline) / baseline * 100 : 0;
+}
+
+// Parses the corpus with both languages (see language_for_name) and prints
+// them side by side, with how far `name` is from `baseline_name`.
+void compare(const vector<SourceFile> &files, unsigned iterations, const string &baseline_name,
+             const string &name) {
+  Result baseline = run(language_for_name(baseline_name), files, iterations);
+  Result result = run(language_for_name(name), files, iterations);
+
+  double baseline_mbps = baseline.mb_per_second(iterations);
+  double mbps = result.mb_per_second(iterations);
+  double bytes = std::max<size_t>(baseline.bytes, 1);
+
+  printf("files: %zu, bytes: %s, iterations: %u\n\n", files.size(),
+         format_bytes(baseline.bytes).c_str(), iterations);
+  printf("%-22s %12s %12s %10s\n", "", baseline_name.c_str(), name.c_str(), "delta");
+  printf("%-22s %12.2f %12.2f %+9.1f%%\n", "throughput (MB/s)", baseline_mbps, mbps,
+         delta_percent(mbps, baseline_mbps));
+  printf("%-22s %12.3f %12.3f %+9.1f%%\n", "p50 latency (ms)",
+         percentile(baseline.latencies, 0.5), percentile(result.latencies, 0.5),
+         delta_percent(percentile(result.latencies, 0.5), percentile(baseline.latencies, 0.5)));
+  printf("%-22s %12.3f %12.3f %+9.1f%%\n", "p99 latency (ms)",
+         percentile(baseline.latencies, 0.99), percentile(result.latencies, 0.99),
+         delta_percent(percentile(result.latencies, 0.99), percentile(baseline.latencies, 0.99)));
+  printf("%-22s %12zu %12zu %+9.1f%%\n", "nodes", baseline.nodes, result.nodes,
+         delta_percent(result.nodes, baseline.nodes));
+  printf("%-22s %12.2f %12.2f %+9.1f%%\n", "tree bytes per byte",
+         baseline.tree_bytes / bytes, result.tree_bytes / bytes,
+         delta_percent(result.tree_bytes, baseline.tree_bytes));
+  printf("%-22s %12s %12s %+9.1f%%\n", "peak parser memory",
+         format_bytes(baseline.peak_bytes).c_str(), format_bytes(result.peak_bytes).c_str(),
+         delta_percent(result.peak_bytes, baseline.peak_bytes));
+  if (baseline.error_files != result.error_files) {
+    printf("\nwarning: %zu files have errors with %s and %zu with %s; the corpus is not "
+           "parsed the same way by both grammars\n", baseline.error_files, baseline_name.c_str(),
+           result.error_files, name.c_str());
+  }
+}
+
+void usage() {
+  fprintf(stderr,
+    "usage: bench-parse [-n ITERATIONS] [--lang blade|strict|html|lite] [--ext EXTENSION] PATH...\n"
+    "       bench-parse --compare-html|--compare-lite [-n ITERATIONS] [--ext EXTENSION] PATH...\n");
+  exit(1);
+}
+
+}
+
+int main(int argc, char **argv) {
+  unsigned iterations = 10;
+  string language_name = "blade";
+  string extension = ".blade.php";
+  bool compare_html = false;
+  bool compare_lite = false;
+  vector<string> paths;
+
+  for (int i = 1; i < argc; i++) {
+    string arg = argv[i];
+    if ((arg == "-n" || arg == "--iterations") && i + 1 < argc) {
+      iterations = atoi(argv[++i]);
+    } else if (arg == "--lang" && i + 1 < argc) {
+      language_name = argv[++i];
+    } else if (arg == "--ext" && i + 1 < argc) {
+      extension = argv[++i];
+    } else if (arg == "--compare-html") {
+      compare_html = true;
+    } else if (arg == "--compare-lite") {
+      compare_lite = true;
+    } else if (arg[0] == '-') {
+      usage();
+    } else {
+      paths.push_back(arg);
+    }
+  }
+  if (paths.empty() || iterations == 0 || (compare_html && compare_lite)) usage();
+
+  // Memory is only reported when comparing, so only then pay for counting.
+  if (compare_html || compare_lite) install_counting_allocator();
+
+  vector<SourceFile> files = load_files(paths, extension);
+  if (files.empty()) {
+    fprintf(stderr, "no input files\n");
+    return 1;
+  }
+
+  if (compare_html) {
+    compare(files, iterations, "html", "blade");
+  } else if (compare_lite) {
+    compare(files, iterations, "blade", "lite");
+  } else {
+    Result result = run(language_for_name(language_name), files, iterations);
+    print_result(language_name, result, iterations, files.size());
+  }
+  return 0;
+}
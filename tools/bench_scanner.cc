@@ -0,0 +1,354 @@
+// Scanner micro-benchmark.
+//
+//   bench-scanner record TRACE [--ext .blade.php] PATH...
+//   bench-scanner replay TRACE [-n ITERATIONS]
+//
+// `record` parses the given files with the real runtime and writes one line
+// per external scanner call: the byte offset, the `valid_symbols` mask and the
+// serialized scanner state at that point. `replay` feeds those calls straight
+// into `Scanner` through an in-memory `TSLexer`, without any parse tables, and
+// reports the cost of each scanner path per call and per byte, along with the
+// cost of `serialize` and `deserialize`.
+
+#include "common.h"
+#include "../src/scanner.cc"
+
+#include <map>
+
+using namespace tools;
+
+namespace {
+
+const unsigned EXTERNAL_TOKEN_COUNT = RAW_ECHO_PHP + 1;
+
+// A `TSLexer` over a UTF-8 buffer that counts how many bytes it advances over,
+// so that a multibyte character counts for its encoded length.
+struct MockLexer {
+  TSLexer lexer;
+  const string *text;
+  uint32_t position;
+  uint32_t next_position;
+  uint32_t end_position;
+  uint32_t advanced_bytes;
+
+  MockLexer(const string *text, uint32_t position) : text(text), advanced_bytes(0) {
+    lexer.advance = advance;
+    lexer.mark_end = mark_end;
+    lexer.get_column = get_column;
+    lexer.is_at_included_range_start = is_at_included_range_start;
+    lexer.eof = eof;
+    reset(position);
+  }
+
+  void reset(uint32_t start) {
+    position = start;
+    end_position = start;
+    advanced_bytes = 0;
+    decode();
+  }
+
+  void decode() {
+    const unsigned char *bytes = reinterpret_cast<const unsigned char *>(text->data());
+    uint32_t size = text->size();
+    if (position >= size) {
+      lexer.lookahead = 0;
+      next_position = position;
+      return;
+    }
+    unsigned char c = bytes[position];
+    unsigned length = c < 0x80 ? 1 : c < 0xE0 ? 2 : c < 0xF0 ? 3 : 4;
+    int32_t code_point = length == 1 ? c : c & (0xFF >> (length + 1));
+    for (unsigned i = 1; i < length && position + i < size; i++) {
+      code_point = (code_point << 6) | (bytes[position + i] & 0x3F);
+    }
+    lexer.lookahead = code_point;
+    next_position = std::min(position + length, size);
+  }
+
+  static void advance(TSLexer *lexer, bool skip) {
+    MockLexer *self = reinterpret_cast<MockLexer *>(lexer);
+    if (self->position >= self->text->size()) return;
+    self->advanced_bytes += self->next_position - self->position;
+    self->position = self->next_position;
+    self->decode();
+  }
+
+  static void mark_end(TSLexer *lexer) {
+    MockLexer *self = reinterpret_cast<MockLexer *>(lexer);
+    self->end_position = self->position;
+  }
+
+  static uint32_t get_column(TSLexer *lexer) {
+    MockLexer *self = reinterpret_cast<MockLexer *>(lexer);
+    uint32_t column = 0;
+    while (column < self->position && (*self->text)[self->position - column - 1] != '\n') column++;
+    return column;
+  }
+
+  static bool is_at_included_range_start(const TSLexer *lexer) {
+    return false;
+  }
+
+  static bool eof(const TSLexer *lexer) {
+    const MockLexer *self = reinterpret_cast<const MockLexer *>(lexer);
+    return self->position >= self->text->size();
+  }
+};
+
+struct ScanRecord {
+  unsigned file;
+  uint32_t offset;
+  bool valid_symbols[EXTERNAL_TOKEN_COUNT];
+  string state;
+};
+
+// Mirrors the dispatch at the top of `Scanner::scan` so that the cost of a
+// call can be attributed to the function that does the work.
+const char *classify(const ScanRecord &record, const string &text) {
+  const bool *valid_symbols = record.valid_symbols;
+  MockLexer mock(&text, record.offset);
+  while (iswspace(mock.lexer.lookahead)) MockLexer::advance(&mock.lexer, true);
+
+  if (valid_symbols[RAW_TEXT] && !valid_symbols[START_TAG_NAME] && !valid_symbols[END_TAG_NAME]) {
+    return "scan_raw_text";
+  }
+  if (valid_symbols[RAW_ECHO_PHP]) return "scan_raw_php";
+
+  switch (mock.lexer.lookahead) {
+    case '<':
+      MockLexer::advance(&mock.lexer, false);
+      if (mock.lexer.lookahead == '!') return "scan_comment";
+      if (valid_symbols[IMPLICIT_END_TAG]) return "scan_implicit_end_tag";
+      break;
+    case '\0':
+      if (valid_symbols[IMPLICIT_END_TAG]) return "scan_implicit_end_tag";
+      break;
+    case '/':
+      if (valid_symbols[SELF_CLOSING_TAG_DELIMITER]) return "scan_self_closing_tag_delimiter";
+      break;
+    default:
+      if ((valid_symbols[START_TAG_NAME] || valid_symbols[END_TAG_NAME]) && !valid_symbols[RAW_TEXT]) {
+        return "scan_tag_name";
+      }
+  }
+  return "no_token";
+}
+
+// Recording
+
+FILE *trace_file;
+unsigned current_file;
+vector<uint32_t> line_offsets;
+uint32_t lex_offset;
+
+void record_log(void *payload, TSLogType type, const char *message) {
+  unsigned state, row, column;
+  if (sscanf(message, "lex_external state:%u, row:%u, column:%u", &state, &row, &column) == 3) {
+    lex_offset = row < line_offsets.size() ? line_offsets[row] + column : 0;
+  }
+}
+
+bool record_scan(void *payload, TSLexer *lexer, const bool *valid_symbols) {
+  char buffer[TREE_SITTER_SERIALIZATION_BUFFER_SIZE];
+  unsigned length = serialize<true>(payload, buffer);
+
+  fprintf(trace_file, "%u %u ", current_file, lex_offset);
+  for (unsigned i = 0; i < EXTERNAL_TOKEN_COUNT; i++) {
+    fputc(valid_symbols[i] ? '1' : '0', trace_file);
+  }
+  fputc(' ', trace_file);
+  for (unsigned i = 0; i < length; i++) {
+    fprintf(trace_file, "%02x", static_cast<unsigned char>(buffer[i]));
+  }
+  fputc('\n', trace_file);
+
+  return scan<true>(payload, lexer, valid_symbols);
+}
+
+int record(const string &trace_path, const vector<string> &paths, const string &extension) {
+  vector<SourceFile> files = load_files(paths, extension);
+  trace_file = fopen(trace_path.c_str(), "w");
+  if (!trace_file) {
+    fprintf(stderr, "could not write %s\n", trace_path.c_str());
+    return 1;
+  }
+
+  static TSLanguage language = *tree_sitter_blade();
+  language.external_scanner.scan = record_scan;
+
+  TSParser *parser = ts_parser_new();
+  ts_parser_set_language(parser, &language);
+  ts_parser_set_logger(parser, TSLogger{NULL, record_log});
+
+  for (unsigned i = 0; i < files.size(); i++) {
+    const string &text = files[i].contents;
+    fprintf(trace_file, "file %u %s\n", i, files[i].path.c_str());
+    line_offsets.assign(1, 0);
+    for (uint32_t j = 0; j < text.size(); j++) {
+      if (text[j] == '\n') line_offsets.push_back(j + 1);
+    }
+    current_file = i;
+    ts_tree_delete(ts_parser_parse_string(parser, NULL, text.data(), text.size()));
+  }
+
+  ts_parser_delete(parser);
+  fclose(trace_file);
+  fprintf(stderr, "recorded %zu files\n", files.size());
+  return 0;
+}
+
+// Replaying
+
+struct Stats {
+  size_t calls = 0;
+  size_t bytes = 0;
+  uint64_t ns = 0;
+};
+
+bool load_trace(const string &path, vector<SourceFile> *files, vector<ScanRecord> *records) {
+  std::ifstream trace(path);
+  if (!trace) return false;
+  string line;
+  while (std::getline(trace, line)) {
+    std::istringstream fields(line);
+    if (line.compare(0, 5, "file ") == 0) {
+      string word;
+      unsigned index;
+      fields >> word >> index >> std::ws;
+      SourceFile file;
+      std::getline(fields, file.path);
+      if (!read_file(file.path, &file.contents)) {
+        fprintf(stderr, "could not read %s\n", file.path.c_str());
+        return false;
+      }
+      files->push_back(std::move(file));
+      continue;
+    }
+
+    ScanRecord record;
+    string mask, state;
+    fields >> record.file >> record.offset >> mask >> state;
+    if (mask.size() != EXTERNAL_TOKEN_COUNT || record.file >= files->size()) continue;
+    for (unsigned i = 0; i < EXTERNAL_TOKEN_COUNT; i++) {
+      record.valid_symbols[i] = mask[i] == '1';
+    }
+    for (size_t i = 0; i + 1 < state.size(); i += 2) {
+      record.state += static_cast<char>(strtoul(state.substr(i, 2).c_str(), NULL, 16));
+    }
+    records->push_back(std::move(record));
+  }
+  return true;
+}
+
+void print_stats(const char *name, const Stats &stats, unsigned iterations) {
+  double calls = static_cast<double>(stats.calls) * iterations;
+  double bytes = static_cast<double>(stats.bytes) * iterations;
+  printf("%-32s %10zu %12zu %10.1f %10.2f\n", name, stats.calls, stats.bytes,
+         calls ? stats.ns / calls : 0, bytes ? stats.ns / bytes : 0);
+}
+
+int replay(const string &trace_path, unsigned iterations) {
+  vector<SourceFile> files;
+  vector<ScanRecord> records;
+  if (!load_trace(trace_path, &files, &records)) {
+    fprintf(stderr, "could not load trace %s\n", trace_path.c_str());
+    return 1;
+  }
+
+  std::map<string, vector<const ScanRecord *>> records_by_path;
+  for (const ScanRecord &record : records) {
+    records_by_path[classify(record, files[record.file].contents)].push_back(&record);
+  }
+
+  Scanner<true> scanner;
+  char buffer[TREE_SITTER_SERIALIZATION_BUFFER_SIZE];
+  std::map<string, Stats> stats;
+
+  for (auto &entry : records_by_path) {
+    const vector<const ScanRecord *> &group = entry.second;
+    Stats &path_stats = stats[entry.first];
+    Stats &deserialize_stats = stats["deserialize"];
+    Stats &serialize_stats = stats["serialize"];
+
+    // Every scan starts from the recorded state, so time deserialize on its
+    // own and subtract it from the combined loop.
+    uint64_t start = now_ns();
+    for (unsigned i = 0; i < iterations; i++) {
+      for (const ScanRecord *record : group) {
+        scanner.deserialize(record->state.data(), record->state.size());
+      }
+    }
+    uint64_t deserialize_ns = now_ns() - start;
+
+    start = now_ns();
+    for (unsigned i = 0; i < iterations; i++) {
+      for (const ScanRecord *record : group) {
+        MockLexer mock(&files[record->file].contents, record->offset);
+        scanner.deserialize(record->state.data(), record->state.size());
+        scanner.scan(&mock.lexer, record->valid_symbols);
+        if (i == 0) path_stats.bytes += mock.advanced_bytes;
+      }
+    }
+    uint64_t scan_ns = now_ns() - start;
+
+    start = now_ns();
+    for (unsigned i = 0; i < iterations; i++) {
+      for (size_t j = 0; j < group.size(); j++) {
+        scanner.serialize(buffer);
+      }
+    }
+    uint64_t serialize_ns = now_ns() - start;
+
+    path_stats.calls += group.size();
+    path_stats.ns += scan_ns > deserialize_ns ? scan_ns - deserialize_ns : 0;
+    for (const ScanRecord *record : group) {
+      deserialize_stats.bytes += record->state.size();
+      scanner.deserialize(record->state.data(), record->state.size());
+      serialize_stats.bytes += scanner.serialize(buffer);
+    }
+    deserialize_stats.calls += group.size();
+    deserialize_stats.ns += deserialize_ns;
+    serialize_stats.calls += group.size();
+    serialize_stats.ns += serialize_ns;
+  }
+
+  printf("%zu scan calls over %zu files, %u iterations\n\n", records.size(), files.size(), iterations);
+  printf("%-32s %10s %12s %10s %10s\n", "function", "calls", "bytes", "ns/call", "ns/byte");
+  for (auto &entry : stats) print_stats(entry.first.c_str(), entry.second, iterations);
+  return 0;
+}
+
+void usage() {
+  fprintf(stderr,
+    "usage: bench-scanner record TRACE [--ext EXTENSION] PATH...\n"
+    "       bench-scanner replay TRACE [-n ITERATIONS]\n");
+  exit(1);
+}
+
+}
+
+int main(int argc, char **argv) {
+  if (argc < 3) usage();
+  string command = argv[1];
+  string trace_path = argv[2];
+  unsigned iterations = 100;
+  string extension = ".blade.php";
+  vector<string> paths;
+
+  for (int i = 3; i < argc; i++) {
+    string arg = argv[i];
+    if ((arg == "-n" || arg == "--iterations") && i + 1 < argc) {
+      iterations = atoi(argv[++i]);
+    } else if (arg == "--ext" && i + 1 < argc) {
+      extension = argv[++i];
+    } else if (arg[0] == '-') {
+      usage();
+    } else {
+      paths.push_back(arg);
+    }
+  }
+
+  if (command == "record" && !paths.empty()) return record(trace_path, paths, extension);
+  if (command == "replay" && iterations > 0) return replay(trace_path, iterations);
+  usage();
+}
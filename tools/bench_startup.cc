@@ -0,0 +1,158 @@
+// Startup benchmark: how long a fresh process takes from loading the grammar
+// library to finishing its first parse.
+//
+//   bench-startup [-n ITERATIONS] [--symbol tree_sitter_blade] [--file PATH] LIBRARY...
+//
+// Each iteration forks a child that dlopens LIBRARY, looks up the language
+// function, creates a parser and parses PATH (or a small built-in template).
+// The child reports each phase back over a pipe, so every sample pays the full
+// cost of loading the library, including its relocations and static
+// initializers. Give several libraries (say, builds from before and after a
+// change) to compare them side by side. `make` builds the library from this
+// checkout as build/libtree-sitter-blade.so.
+
+#include "common.h"
+
+#include <dlfcn.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+using namespace tools;
+
+namespace {
+
+const char *const DEFAULT_SOURCE =
+  "@extends('layouts.app')\n"
+  "@section('content')\n"
+  "  <div class=\"container\">\n"
+  "    <x-alert type=\"error\" :message=\"$message\" />\n"
+  "    @foreach ($users as $user)\n"
+  "      <p>{{ $user->name }}</p>\n"
+  "    @endforeach\n"
+  "  </div>\n"
+  "@endsection\n";
+
+enum Phase {
+  DLOPEN_PHASE,
+  LANGUAGE_PHASE,
+  FIRST_PARSE_PHASE,
+  TOTAL_PHASE,
+  PHASE_COUNT,
+};
+
+const char *const PHASE_NAMES[PHASE_COUNT] = {"dlopen", "language", "first parse", "total"};
+
+struct Sample {
+  uint64_t ns[PHASE_COUNT];
+};
+
+// Runs in the child. Returns false if the library could not be used.
+bool measure(const string &library, const string &symbol, const string &source, Sample *sample) {
+  uint64_t start = now_ns();
+  void *handle = dlopen(library.c_str(), RTLD_NOW | RTLD_LOCAL);
+  if (!handle) {
+    fprintf(stderr, "%s\n", dlerror());
+    return false;
+  }
+  uint64_t loaded = now_ns();
+
+  typedef const TSLanguage *(*LanguageFunction)(void);
+  LanguageFunction language_function = reinterpret_cast<LanguageFunction>(dlsym(handle, symbol.c_str()));
+  if (!language_function) {
+    fprintf(stderr, "%s: no symbol %s\n", library.c_str(), symbol.c_str());
+    return false;
+  }
+  TSParser *parser = ts_parser_new();
+  ts_parser_set_language(parser, language_function());
+  uint64_t ready = now_ns();
+
+  TSTree *tree = ts_parser_parse_string(parser, NULL, source.data(), source.size());
+  uint64_t parsed = now_ns();
+
+  sample->ns[DLOPEN_PHASE] = loaded - start;
+  sample->ns[LANGUAGE_PHASE] = ready - loaded;
+  sample->ns[FIRST_PARSE_PHASE] = parsed - ready;
+  sample->ns[TOTAL_PHASE] = parsed - start;
+  ts_tree_delete(tree);
+  ts_parser_delete(parser);
+  return true;
+}
+
+bool run_child(const string &library, const string &symbol, const string &source, Sample *sample) {
+  int fds[2];
+  if (pipe(fds) != 0) return false;
+
+  pid_t pid = fork();
+  if (pid < 0) return false;
+  if (pid == 0) {
+    close(fds[0]);
+    Sample result;
+    bool ok = measure(library, symbol, source, &result) &&
+              write(fds[1], &result, sizeof(result)) == sizeof(result);
+    _exit(ok ? 0 : 1);
+  }
+
+  close(fds[1]);
+  bool ok = read(fds[0], sample, sizeof(*sample)) == sizeof(*sample);
+  close(fds[0]);
+  int status;
+  waitpid(pid, &status, 0);
+  return ok && WIFEXITED(status) && WEXITSTATUS(status) == 0;
+}
+
+void usage() {
+  fprintf(stderr, "usage: bench-startup [-n ITERATIONS] [--symbol NAME] [--file PATH] LIBRARY...\n");
+  exit(1);
+}
+
+}
+
+int main(int argc, char **argv) {
+  unsigned iterations = 100;
+  string symbol = "tree_sitter_blade";
+  string source = DEFAULT_SOURCE;
+  vector<string> libraries;
+
+  for (int i = 1; i < argc; i++) {
+    string arg = argv[i];
+    if ((arg == "-n" || arg == "--iterations") && i + 1 < argc) {
+      iterations = atoi(argv[++i]);
+    } else if (arg == "--symbol" && i + 1 < argc) {
+      symbol = argv[++i];
+    } else if (arg == "--file" && i + 1 < argc) {
+      if (!read_file(argv[++i], &source)) {
+        fprintf(stderr, "could not read %s\n", argv[i]);
+        return 1;
+      }
+    } else if (arg[0] == '-') {
+      usage();
+    } else {
+      // dlopen only searches the library path for names without a slash.
+      libraries.push_back(arg.find('/') == string::npos ? "./" + arg : arg);
+    }
+  }
+  if (libraries.empty() || iterations == 0) usage();
+
+  printf("%-40s %-12s %10s %10s %10s\n", "library", "phase", "p50 us", "p99 us", "max us");
+  for (const string &library : libraries) {
+    vector<double> samples[PHASE_COUNT];
+    for (unsigned i = 0; i < iterations; i++) {
+      Sample sample;
+      if (!run_child(library, symbol, source, &sample)) {
+        fprintf(stderr, "%s: child failed\n", library.c_str());
+        return 1;
+      }
+      for (unsigned phase = 0; phase < PHASE_COUNT; phase++) {
+        samples[phase].push_back(sample.ns[phase] / 1e3);
+      }
+    }
+
+    for (unsigned phase = 0; phase < PHASE_COUNT; phase++) {
+      vector<double> &values = samples[phase];
+      printf("%-40s %-12s %10.1f %10.1f %10.1f\n", phase == 0 ? library.c_str() : "",
+             PHASE_NAMES[phase], percentile(values, 0.5), percentile(values, 0.99),
+             *std::max_element(values.begin(), values.end()));
+    }
+  }
+  return 0;
+}
@@ -0,0 +1,107 @@
+// Template pack builder (see template_pack.h).
+//
+//   blade-pack [--ext .blade.php] -o PACK PATH...
+//   blade-pack --list PACK
+//
+// Collects the templates under each PATH like blade-parse does and writes
+// them into PACK, which should end in .bladepack so that the other tools
+// recognize it. Templates found under a directory are stored with their path
+// relative to it (`resources/views` gives `layouts/app.blade.php`), which is
+// also what view names are derived from; files named directly keep their
+// path as given. --list prints the path and size of every template in PACK.
+//
+// A pack turns a batch run over a view tree into one sequential read:
+//
+//   blade-pack -o /tmp/views.bladepack /tmp/views
+//   blade-parse /tmp/views.bladepack > /dev/null
+//   bench-parse /tmp/views.bladepack
+
+#include "common.h"
+#include "template_pack.h"
+
+using namespace tools;
+
+namespace {
+
+int list(const string &path) {
+  TemplatePack pack;
+  if (!pack.open(path)) {
+    fprintf(stderr, "could not read template pack %s\n", path.c_str());
+    return 1;
+  }
+  size_t total_bytes = 0;
+  for (size_t i = 0; i < pack.size(); i++) {
+    TemplatePack::Entry entry = pack.entry(i);
+    printf("%10u  %.*s\n", entry.length, int(entry.path.size()), entry.path.data());
+    total_bytes += entry.length;
+  }
+  fprintf(stderr, "%zu templates, %s in a %s pack\n", pack.size(), format_bytes(total_bytes).c_str(),
+          format_bytes(pack.file_size()).c_str());
+  return 0;
+}
+
+void usage() {
+  fprintf(stderr,
+    "usage: blade-pack [--ext EXTENSION] -o PACK PATH...\n"
+    "       blade-pack --list PACK\n");
+  exit(1);
+}
+
+}
+
+int main(int argc, char **argv) {
+  string extension = ".blade.php";
+  string output_path;
+  string list_path;
+  vector<string> paths;
+
+  for (int i = 1; i < argc; i++) {
+    string arg = argv[i];
+    if (arg == "--ext" && i + 1 < argc) {
+      extension = argv[++i];
+    } else if ((arg == "-o" || arg == "--output") && i + 1 < argc) {
+      output_path = argv[++i];
+    } else if (arg == "--list" && i + 1 < argc) {
+      list_path = argv[++i];
+    } else if (arg[0] == '-') {
+      usage();
+    } else {
+      paths.push_back(arg);
+    }
+  }
+  if (!list_path.empty()) {
+    if (!output_path.empty() || !paths.empty()) usage();
+    return list(list_path);
+  }
+  if (output_path.empty() || paths.empty()) usage();
+
+  vector<PackSource> sources;
+  for (const string &path : paths) {
+    std::error_code error;
+    bool directory = std::filesystem::is_directory(path, error);
+    for (const string &file : collect_paths({path}, extension)) {
+      string stored = file;
+      if (directory && stored.compare(0, path.size(), path) == 0) {
+        stored.erase(0, path.size());
+        while (!stored.empty() && stored[0] == '/') stored.erase(0, 1);
+      }
+      sources.push_back(PackSource{stored, file});
+    }
+  }
+  if (sources.empty()) {
+    fprintf(stderr, "no input files\n");
+    return 1;
+  }
+
+  uint64_t start = now_ns();
+  string error;
+  if (!write_template_pack(output_path, sources, &error)) {
+    fprintf(stderr, "%s\n", error.c_str());
+    return 1;
+  }
+  std::error_code size_error;
+  uintmax_t pack_bytes = std::filesystem::file_size(output_path, size_error);
+  fprintf(stderr, "%zu templates into %s (%s) in %.2f s\n", sources.size(), output_path.c_str(),
+          format_bytes(size_error ? 0 : pack_bytes).c_str(), (now_ns() - start) / 1e9);
+  return 0;
+}
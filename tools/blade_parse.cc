@@ -0,0 +1,454 @@
+// Batch parser for whole view trees.
+//
+//   blade-parse [-j THREADS] [--lang blade|strict] [--ext .blade.php]
+//               [--max-errors N] [--references] [--cache FILE] [-o FILE] PATH...
+//
+// Walks the given directories, parses every matching file and writes one JSON
+// object per file:
+//
+//   {"path":"resources/views/welcome.blade.php","bytes":2154,"nodes":431,
+//    "parse_us":182.4,"errors":[{"kind":"ERROR","start":[12,4],"end":[12,19]}],
+//    "error_count":1}
+//
+// Rows and columns are zero-based, columns in bytes. MISSING nodes carry the
+// expected symbol as "symbol". At most --max-errors (default 16) errors are
+// listed, but all are counted. Files that cannot be read get an "error" field
+// instead of the parse fields. Lines are written in completion order, not in
+// path order; a summary goes to stderr.
+//
+// --references adds the views, sections and stacks the file refers to (see
+// template_index.h), in source order:
+//
+//   "references":[{"kind":"extends","name":"layouts.app","start":0}]
+//
+// With --cache, results are looked up by content hash in FILE (see
+// parse_cache.h) before parsing, each line gets a "cached" field, and FILE is
+// rewritten at the end with the results of this run. Cached lines have a
+// "parse_us" of 0; their references come from the cache too.
+//
+// Files are mapped rather than read (see file_input.h), so a huge generated
+// view costs no more memory than its tree. A template pack (template_pack.h,
+// built with blade-pack) given as a PATH stands for the templates in it;
+// they are parsed straight from the mapped pack, and reported with the paths
+// stored in it. Each worker thread keeps one parser for the whole run. The file list is
+// split into equal ranges, one per worker; a worker that runs out of files
+// steals the back half of the largest remaining range, so a few large views
+// do not leave the other threads idle.
+
+#include "common.h"
+#include "file_input.h"
+#include "parse_cache.h"
+#include "scanner_pool.h"
+#include "template_index.h"
+#include "template_pack.h"
+
+#include <mutex>
+#include <thread>
+
+using namespace tools;
+
+namespace {
+
+struct Options {
+  unsigned thread_count = 0;
+  const TSLanguage *language = NULL;
+  unsigned max_errors = 16;
+  bool references = false;
+  FILE *output = stdout;
+  ParseCache *cache = NULL;
+  // Set when references are listed or cached.
+  const ReferenceExtractor *extractor = NULL;
+};
+
+// The files still to be parsed by one worker, as indices into the path list.
+// The owner takes from the front, thieves take from the back.
+struct WorkRange {
+  std::mutex mutex;
+  size_t begin = 0;
+  size_t end = 0;
+};
+
+struct WorkerTotals {
+  size_t files = 0;
+  size_t bytes = 0;
+  size_t files_with_errors = 0;
+  size_t unreadable = 0;
+  size_t stolen = 0;
+  size_t cached = 0;
+};
+
+// A file to parse, or an entry of a template pack.
+struct Input {
+  string path;
+  const TemplatePack *pack = NULL;
+  size_t entry = 0;
+};
+
+struct Batch {
+  const vector<Input> *inputs;
+  const Options *options;
+  vector<WorkRange> ranges;
+  std::mutex output_mutex;
+};
+
+bool take(WorkRange *range, size_t *index) {
+  std::lock_guard<std::mutex> lock(range->mutex);
+  if (range->begin == range->end) return false;
+  *index = range->begin++;
+  return true;
+}
+
+// Moves the back half of the fullest other range into the (empty) range of
+// worker `self`. Returns false once every range is empty.
+bool steal(Batch *batch, unsigned self) {
+  for (;;) {
+    unsigned victim = self;
+    size_t most = 0;
+    for (unsigned i = 0; i < batch->ranges.size(); i++) {
+      if (i == self) continue;
+      WorkRange &range = batch->ranges[i];
+      std::lock_guard<std::mutex> lock(range.mutex);
+      if (range.end - range.begin > most) {
+        most = range.end - range.begin;
+        victim = i;
+      }
+    }
+    if (victim == self) return false;
+
+    WorkRange &range = batch->ranges[victim];
+    size_t begin, end;
+    {
+      std::lock_guard<std::mutex> lock(range.mutex);
+      size_t remaining = range.end - range.begin;
+      // The victim finished its range while we were looking; pick again.
+      if (remaining == 0) continue;
+      size_t count = (remaining + 1) / 2;
+      end = range.end;
+      begin = range.end - count;
+      range.end = begin;
+    }
+    WorkRange &own = batch->ranges[self];
+    std::lock_guard<std::mutex> lock(own.mutex);
+    own.begin = begin;
+    own.end = end;
+    return true;
+  }
+}
+
+void append_json_string(string *out, const char *s, size_t length) {
+  out->push_back('"');
+  for (size_t i = 0; i < length; i++) {
+    unsigned char c = s[i];
+    switch (c) {
+      case '"': out->append("\\\""); break;
+      case '\\': out->append("\\\\"); break;
+      case '\n': out->append("\\n"); break;
+      case '\r': out->append("\\r"); break;
+      case '\t': out->append("\\t"); break;
+      default:
+        if (c < 0x20) {
+          char escape[8];
+          snprintf(escape, sizeof(escape), "\\u%04x", c);
+          out->append(escape);
+        } else {
+          out->push_back(c);
+        }
+    }
+  }
+  out->push_back('"');
+}
+
+void append_json_string(string *out, const string &s) {
+  append_json_string(out, s.data(), s.size());
+}
+
+void append_point(string *out, TSPoint point) {
+  char buffer[32];
+  snprintf(buffer, sizeof(buffer), "[%u,%u]", point.row, point.column);
+  out->append(buffer);
+}
+
+// Appends the first `max_errors` diagnostics to `out` as a JSON array.
+void append_errors(string *out, const TSLanguage *language, const Diagnostic *diagnostics,
+                   size_t count, unsigned max_errors) {
+  out->push_back('[');
+  for (size_t i = 0; i < count && i < max_errors; i++) {
+    const Diagnostic &diagnostic = diagnostics[i];
+    if (i > 0) out->push_back(',');
+    if (diagnostic.flags & ERROR_NODE) {
+      out->append("{\"kind\":\"ERROR\"");
+    } else {
+      const char *symbol = ts_language_symbol_name(language, diagnostic.symbol);
+      out->append("{\"kind\":\"MISSING\",\"symbol\":");
+      append_json_string(out, symbol, strlen(symbol));
+    }
+    out->append(",\"start\":");
+    append_point(out, diagnostic.start_point);
+    out->append(",\"end\":");
+    append_point(out, diagnostic.end_point);
+    out->push_back('}');
+  }
+  out->push_back(']');
+}
+
+void append_reference(string *out, ReferenceKind kind, uint32_t start_byte, std::string_view name) {
+  out->append("{\"kind\":\"");
+  out->append(REFERENCE_KIND_NAMES[kind]);
+  out->append("\",\"name\":");
+  append_json_string(out, name.data(), name.size());
+  char buffer[32];
+  snprintf(buffer, sizeof(buffer), ",\"start\":%u}", start_byte);
+  out->append(buffer);
+}
+
+void flush(Batch *batch, string *lines) {
+  std::lock_guard<std::mutex> lock(batch->output_mutex);
+  fwrite(lines->data(), 1, lines->size(), batch->options->output);
+  lines->clear();
+}
+
+void run_worker(Batch *batch, unsigned self, WorkerTotals *totals) {
+  const Options &options = *batch->options;
+  TSParser *parser = ts_parser_new();
+  ts_parser_set_language(parser, options.language);
+
+  FileInput input;
+  string contents;
+  ParseResult result;
+  string lines;
+  char number[96];
+  for (;;) {
+    size_t index;
+    if (!take(&batch->ranges[self], &index)) {
+      if (!steal(batch, self)) break;
+      totals->stolen++;
+      continue;
+    }
+
+    const Input &source = (*batch->inputs)[index];
+    lines.append("{\"path\":");
+    append_json_string(&lines, source.path);
+    const char *data = NULL;
+    uint32_t length = 0;
+    bool readable = true;
+    if (source.pack) {
+      TemplatePack::Entry entry = source.pack->entry(source.entry);
+      data = entry.data;
+      length = entry.length;
+    } else if ((readable = input.open(source.path))) {
+      data = input.data();
+      length = input.size();
+      // Hashing and finding references need the whole file at once.
+      if (!data && options.extractor) {
+        readable = read_file(source.path, &contents) && contents.size() == length;
+        data = contents.data();
+      }
+    }
+    if (!readable) {
+      lines.append(",\"error\":\"could not read file\"}\n");
+      totals->unreadable++;
+    } else {
+      uint64_t hash = options.cache ? hash_bytes(data, length) : 0;
+      CachedResult cached;
+      size_t node_count;
+      const Diagnostic *diagnostics;
+      size_t error_count;
+      double parse_us = 0;
+      bool hit = options.cache && options.cache->find(hash, data, length, &cached);
+      if (hit) {
+        node_count = cached.node_count;
+        diagnostics = cached.diagnostics;
+        error_count = cached.diagnostic_count;
+        totals->cached++;
+      } else {
+        uint64_t start = now_ns();
+        TSTree *tree = data ? ts_parser_parse_string(parser, NULL, data, length)
+                            : ts_parser_parse(parser, NULL, input.input());
+        parse_us = (now_ns() - start) / 1e3;
+        TSNode root = ts_tree_root_node(tree);
+        if (options.cache) {
+          flatten_tree(root, &result);
+          node_count = result.nodes.size();
+        } else {
+          result.clear();
+          collect_diagnostics(root, &result.diagnostics);
+          node_count = count_nodes(root);
+        }
+        if (options.extractor) {
+          options.extractor->extract(root, std::string_view(data, length), &result.references);
+        }
+        if (options.cache) options.cache->add(hash, data, length, result);
+        ts_tree_delete(tree);
+        diagnostics = result.diagnostics.data();
+        error_count = result.diagnostics.size();
+      }
+
+      snprintf(number, sizeof(number), ",\"bytes\":%zu,\"nodes\":%zu,\"parse_us\":%.1f,",
+               size_t(length), node_count, parse_us);
+      lines.append(number);
+      if (options.cache) lines.append(hit ? "\"cached\":true," : "\"cached\":false,");
+      lines.append("\"errors\":");
+      append_errors(&lines, options.language, diagnostics, error_count, options.max_errors);
+      snprintf(number, sizeof(number), ",\"error_count\":%zu", error_count);
+      lines.append(number);
+      if (options.references) {
+        lines.append(",\"references\":[");
+        if (hit) {
+          for (uint32_t i = 0; i < cached.reference_count; i++) {
+            if (i > 0) lines.push_back(',');
+            const CachedReference &reference = cached.references[i];
+            append_reference(&lines, reference.kind, reference.start_byte, cached.name(reference));
+          }
+        } else {
+          for (size_t i = 0; i < result.references.size(); i++) {
+            if (i > 0) lines.push_back(',');
+            const Reference &reference = result.references[i];
+            append_reference(&lines, reference.kind, reference.start_byte, reference.name);
+          }
+        }
+        lines.push_back(']');
+      }
+      lines.append("}\n");
+
+      totals->files++;
+      totals->bytes += length;
+      if (error_count) totals->files_with_errors++;
+    }
+
+    if (lines.size() >= 64 * 1024) flush(batch, &lines);
+  }
+
+  if (!lines.empty()) flush(batch, &lines);
+  ts_parser_delete(parser);
+  tree_sitter_blade_scanner_pool_clear();
+}
+
+void usage() {
+  fprintf(stderr,
+    "usage: blade-parse [-j THREADS] [--lang blade|strict] [--ext EXTENSION]\n"
+    "                   [--max-errors N] [--references] [--cache FILE] [-o FILE] PATH...\n");
+  exit(1);
+}
+
+}
+
+int main(int argc, char **argv) {
+  Options options;
+  string language_name = "blade";
+  string extension = ".blade.php";
+  string output_path;
+  string cache_path;
+  vector<string> paths;
+
+  for (int i = 1; i < argc; i++) {
+    string arg = argv[i];
+    if ((arg == "-j" || arg == "--threads") && i + 1 < argc) {
+      options.thread_count = atoi(argv[++i]);
+    } else if (arg == "--lang" && i + 1 < argc) {
+      language_name = argv[++i];
+    } else if (arg == "--ext" && i + 1 < argc) {
+      extension = argv[++i];
+    } else if (arg == "--max-errors" && i + 1 < argc) {
+      options.max_errors = strtoul(argv[++i], NULL, 10);
+    } else if (arg == "--references") {
+      options.references = true;
+    } else if (arg == "--cache" && i + 1 < argc) {
+      cache_path = argv[++i];
+    } else if ((arg == "-o" || arg == "--output") && i + 1 < argc) {
+      output_path = argv[++i];
+    } else if (arg[0] == '-') {
+      usage();
+    } else {
+      paths.push_back(arg);
+    }
+  }
+  if (paths.empty()) usage();
+  if (language_name != "blade" && language_name != "strict") usage();
+  options.language = language_for_name(language_name);
+  if (options.thread_count == 0) options.thread_count = std::max(1u, std::thread::hardware_concurrency());
+
+  if (!output_path.empty()) {
+    options.output = fopen(output_path.c_str(), "w");
+    if (!options.output) {
+      fprintf(stderr, "could not open %s\n", output_path.c_str());
+      return 1;
+    }
+  }
+
+  vector<Input> files;
+  vector<std::unique_ptr<TemplatePack>> packs;
+  for (const string &path : collect_paths(paths, extension)) {
+    if (!has_suffix(path, TEMPLATE_PACK_EXTENSION)) {
+      files.push_back(Input{path});
+      continue;
+    }
+    packs.emplace_back(new TemplatePack());
+    if (!packs.back()->open(path)) {
+      fprintf(stderr, "could not read template pack %s\n", path.c_str());
+      return 1;
+    }
+    for (size_t i = 0; i < packs.back()->size(); i++) {
+      files.push_back(Input{string(packs.back()->entry(i).path), packs.back().get(), i});
+    }
+  }
+  if (files.empty()) {
+    fprintf(stderr, "no input files\n");
+    return 1;
+  }
+
+  std::unique_ptr<ReferenceExtractor> extractor;
+  if (options.references || !cache_path.empty()) {
+    extractor.reset(new ReferenceExtractor(options.language));
+    options.extractor = extractor.get();
+  }
+  std::unique_ptr<ParseCache> cache;
+  if (!cache_path.empty()) {
+    cache.reset(new ParseCache(grammar_fingerprint(options.language, language_name)));
+    cache->load(cache_path);
+    options.cache = cache.get();
+  }
+
+  unsigned thread_count = std::min<size_t>(options.thread_count, files.size());
+  Batch batch;
+  batch.inputs = &files;
+  batch.options = &options;
+  batch.ranges = vector<WorkRange>(thread_count);
+  for (unsigned i = 0; i < thread_count; i++) {
+    batch.ranges[i].begin = files.size() * i / thread_count;
+    batch.ranges[i].end = files.size() * (i + 1) / thread_count;
+  }
+
+  vector<WorkerTotals> totals(thread_count);
+  uint64_t start = now_ns();
+  vector<std::thread> threads;
+  for (unsigned i = 0; i < thread_count; i++) {
+    threads.emplace_back(run_worker, &batch, i, &totals[i]);
+  }
+  for (std::thread &thread : threads) thread.join();
+  double seconds = (now_ns() - start) / 1e9;
+  if (options.output != stdout) fclose(options.output);
+
+  WorkerTotals total;
+  for (const WorkerTotals &worker : totals) {
+    total.files += worker.files;
+    total.bytes += worker.bytes;
+    total.files_with_errors += worker.files_with_errors;
+    total.unreadable += worker.unreadable;
+    total.stolen += worker.stolen;
+    total.cached += worker.cached;
+  }
+  fprintf(stderr, "%zu files, %s in %.2f s on %u threads (%.1f MB/s, %zu steals); "
+          "%zu with errors, %zu unreadable\n",
+          total.files, format_bytes(total.bytes).c_str(), seconds, thread_count,
+          total.bytes / seconds / (1024 * 1024), total.stolen,
+          total.files_with_errors, total.unreadable);
+  if (cache) {
+    fprintf(stderr, "cache: %zu of %zu files from %s (%.1f%%)\n", total.cached, total.files,
+            cache_path.c_str(), total.files ? 100.0 * total.cached / total.files : 0.0);
+    if (!cache->save(cache_path)) {
+      fprintf(stderr, "could not write %s\n", cache_path.c_str());
+      return 1;
+    }
+  }
+  return total.unreadable ? 1 : 0;
+}
@@ -0,0 +1,297 @@
+#ifndef TREE_SITTER_BLADE_TOOLS_COMMON_H_
+#define TREE_SITTER_BLADE_TOOLS_COMMON_H_
+
+#include <tree_sitter/api.h>
+#include <tree_sitter/parser.h>
+#include <sys/resource.h>
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "template_pack.h"
+
+extern "C" {
+const TSLanguage *tree_sitter_blade(void);
+const TSLanguage *tree_sitter_blade_strict(void);
+#ifdef TREE_SITTER_BLADE_HTML
+const TSLanguage *tree_sitter_html(void);
+#endif
+#ifdef TREE_SITTER_BLADE_LITE
+const TSLanguage *tree_sitter_blade_lite(void);
+#endif
+}
+
+namespace tools {
+
+using std::string;
+using std::vector;
+
+struct SourceFile {
+  string path;
+  string contents;
+};
+
+inline bool has_suffix(const string &s, const string &suffix) {
+  return s.size() >= suffix.size() &&
+         s.compare(s.size() - suffix.size(), suffix.size(), suffix) == 0;
+}
+
+inline bool read_file(const string &path, string *contents) {
+  std::ifstream file(path, std::ios::binary);
+  if (!file) return false;
+  std::ostringstream buffer;
+  buffer << file.rdbuf();
+  *contents = buffer.str();
+  return true;
+}
+
+// Expands the given paths into a sorted list of files. Directories are walked
+// recursively and only files ending in `extension` are kept; paths naming a
+// file directly are always included.
+inline vector<string> collect_paths(const vector<string> &paths,
+                                    const string &extension = ".blade.php") {
+  namespace fs = std::filesystem;
+  vector<string> result;
+  for (const string &path : paths) {
+    std::error_code error;
+    if (fs::is_directory(path, error)) {
+      for (fs::recursive_directory_iterator it(path, error), end; it != end; it.increment(error)) {
+        if (error) break;
+        if (it->is_regular_file(error) && has_suffix(it->path().string(), extension)) {
+          result.push_back(it->path().string());
+        }
+      }
+    } else {
+      result.push_back(path);
+    }
+  }
+  std::sort(result.begin(), result.end());
+  return result;
+}
+
+// Reads the files named by `paths` (see collect_paths). A template pack
+// (template_pack.h) named directly stands for all the templates in it.
+inline vector<SourceFile> load_files(const vector<string> &paths,
+                                     const string &extension = ".blade.php") {
+  vector<SourceFile> files;
+  for (const string &path : collect_paths(paths, extension)) {
+    if (has_suffix(path, TEMPLATE_PACK_EXTENSION)) {
+      TemplatePack pack;
+      if (!pack.open(path)) {
+        fprintf(stderr, "could not read template pack %s\n", path.c_str());
+        exit(1);
+      }
+      for (size_t i = 0; i < pack.size(); i++) {
+        TemplatePack::Entry entry = pack.entry(i);
+        files.push_back(SourceFile{string(entry.path), string(entry.data, entry.length)});
+      }
+      continue;
+    }
+    SourceFile file{path, string()};
+    if (!read_file(path, &file.contents)) {
+      fprintf(stderr, "could not read %s\n", path.c_str());
+      exit(1);
+    }
+    files.push_back(std::move(file));
+  }
+  return files;
+}
+
+inline uint64_t now_ns() {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+    std::chrono::steady_clock::now().time_since_epoch()
+  ).count();
+}
+
+// `p` is in [0, 1]. Sorts `samples` in place.
+inline double percentile(vector<double> &samples, double p) {
+  if (samples.empty()) return 0;
+  std::sort(samples.begin(), samples.end());
+  size_t index = static_cast<size_t>(p * (samples.size() - 1) + 0.5);
+  return samples[index];
+}
+
+inline double peak_rss_mb() {
+  struct rusage usage;
+  getrusage(RUSAGE_SELF, &usage);
+#ifdef __APPLE__
+  return usage.ru_maxrss / (1024.0 * 1024.0);
+#else
+  return usage.ru_maxrss / 1024.0;
+#endif
+}
+
+inline size_t count_nodes(TSNode root) {
+  size_t count = 0;
+  TSTreeCursor cursor = ts_tree_cursor_new(root);
+  for (;;) {
+    count++;
+    if (ts_tree_cursor_goto_first_child(&cursor)) continue;
+    while (!ts_tree_cursor_goto_next_sibling(&cursor)) {
+      if (!ts_tree_cursor_goto_parent(&cursor)) {
+        ts_tree_cursor_delete(&cursor);
+        return count;
+      }
+    }
+  }
+}
+
+inline const TSLanguage *language_for_name(const string &name) {
+  if (name == "blade") return tree_sitter_blade();
+  if (name == "strict") return tree_sitter_blade_strict();
+#ifdef TREE_SITTER_BLADE_HTML
+  if (name == "html") return tree_sitter_html();
+#endif
+#ifdef TREE_SITTER_BLADE_LITE
+  if (name == "lite") return tree_sitter_blade_lite();
+#endif
+  fprintf(stderr, "unknown language '%s' (expected blade or strict; html needs `make HTML=1` and lite `make LITE=1`)\n",
+          name.c_str());
+  exit(1);
+}
+
+struct ScannerCounters {
+  uint64_t scans;
+  uint64_t advances;
+  uint64_t serializations;
+  uint64_t serialized_bytes;
+  uint64_t deserializations;
+};
+
+// Filled in by the scanner wrappers installed by `instrument_scanner`.
+inline ScannerCounters scanner_counters;
+
+namespace internal {
+
+inline TSLanguage instrumented_language;
+inline void (*lexer_advance)(TSLexer *, bool);
+
+inline void counting_advance(TSLexer *lexer, bool skip) {
+  scanner_counters.advances++;
+  lexer_advance(lexer, skip);
+}
+
+inline bool counting_scan(void *payload, TSLexer *lexer, const bool *valid_symbols) {
+  scanner_counters.scans++;
+  lexer_advance = lexer->advance;
+  lexer->advance = counting_advance;
+  bool result = tree_sitter_blade()->external_scanner.scan(payload, lexer, valid_symbols);
+  lexer->advance = lexer_advance;
+  return result;
+}
+
+inline unsigned counting_serialize(void *payload, char *buffer) {
+  unsigned length = tree_sitter_blade()->external_scanner.serialize(payload, buffer);
+  scanner_counters.serializations++;
+  scanner_counters.serialized_bytes += length;
+  return length;
+}
+
+inline void counting_deserialize(void *payload, const char *buffer, unsigned length) {
+  scanner_counters.deserializations++;
+  tree_sitter_blade()->external_scanner.deserialize(payload, buffer, length);
+}
+
+}
+
+// Returns a copy of `tree_sitter_blade()` whose external scanner counts its
+// calls, and the lexer advances made from inside `scan`, in
+// `scanner_counters`. The counters are process-wide, so only use this from a
+// single thread.
+inline const TSLanguage *instrument_scanner() {
+  internal::instrumented_language = *tree_sitter_blade();
+  internal::instrumented_language.external_scanner.scan = internal::counting_scan;
+  internal::instrumented_language.external_scanner.serialize = internal::counting_serialize;
+  internal::instrumented_language.external_scanner.deserialize = internal::counting_deserialize;
+  return &internal::instrumented_language;
+}
+
+struct AllocationCounters {
+  uint64_t allocations;
+  uint64_t allocated_bytes;
+  int64_t live_bytes;
+  int64_t peak_bytes;
+};
+
+// Filled in by the allocator installed by `install_counting_allocator`.
+inline AllocationCounters allocation_counters;
+
+namespace internal {
+
+// Each block is prefixed with its size so that frees can be accounted for.
+const size_t ALLOCATION_HEADER = 16;
+
+inline void *count_allocation(void *block, size_t size) {
+  if (!block) return NULL;
+  *static_cast<size_t *>(block) = size;
+  allocation_counters.allocations++;
+  allocation_counters.allocated_bytes += size;
+  allocation_counters.live_bytes += size;
+  if (allocation_counters.live_bytes > allocation_counters.peak_bytes) {
+    allocation_counters.peak_bytes = allocation_counters.live_bytes;
+  }
+  return static_cast<char *>(block) + ALLOCATION_HEADER;
+}
+
+inline void *block_for(void *pointer) {
+  return static_cast<char *>(pointer) - ALLOCATION_HEADER;
+}
+
+inline void counting_free(void *pointer) {
+  if (!pointer) return;
+  void *block = block_for(pointer);
+  allocation_counters.live_bytes -= *static_cast<size_t *>(block);
+  free(block);
+}
+
+inline void *counting_malloc(size_t size) {
+  return count_allocation(malloc(size + ALLOCATION_HEADER), size);
+}
+
+inline void *counting_calloc(size_t count, size_t size) {
+  return count_allocation(calloc(1, count * size + ALLOCATION_HEADER), count * size);
+}
+
+inline void *counting_realloc(void *pointer, size_t size) {
+  if (!pointer) return counting_malloc(size);
+  void *block = block_for(pointer);
+  size_t old_size = *static_cast<size_t *>(block);
+  void *new_block = realloc(block, size + ALLOCATION_HEADER);
+  if (!new_block) return NULL;
+  allocation_counters.live_bytes -= old_size;
+  allocation_counters.allocations--;
+  allocation_counters.allocated_bytes -= old_size;
+  return count_allocation(new_block, size);
+}
+
+}
+
+// Routes all allocations made by the tree-sitter runtime through counters in
+// `allocation_counters`. Must be called before the first parser is created.
+inline void install_counting_allocator() {
+  ts_set_allocator(internal::counting_malloc, internal::counting_calloc,
+                   internal::counting_realloc, internal::counting_free);
+}
+
+inline string format_bytes(double bytes) {
+  char buffer[32];
+  if (bytes >= 1024 * 1024) {
+    snprintf(buffer, sizeof(buffer), "%.2f MB", bytes / (1024 * 1024));
+  } else if (bytes >= 1024) {
+    snprintf(buffer, sizeof(buffer), "%.2f KB", bytes / 1024);
+  } else {
+    snprintf(buffer, sizeof(buffer), "%.0f B", bytes);
+  }
+  return buffer;
+}
+
+}
+
+#endif  // TREE_SITTER_BLADE_TOOLS_COMMON_H_
@@ -0,0 +1,93 @@
+#include "file_input.h"
+#include <errno.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace tools {
+
+bool FileInput::open(const string &path, bool map, uint32_t chunk_size) {
+  close();
+  int fd = ::open(path.c_str(), O_RDONLY);
+  if (fd < 0) return false;
+  struct stat info;
+  if (fstat(fd, &info) != 0 || uint64_t(info.st_size) >= UINT32_MAX) {
+    ::close(fd);
+    return false;
+  }
+  size_ = info.st_size;
+
+  if (size_ == 0) {
+    ::close(fd);
+    return true;
+  }
+  if (map && S_ISREG(info.st_mode)) {
+    void *mapping = mmap(NULL, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (mapping != MAP_FAILED) {
+      ::close(fd);
+      // The lexer goes through the file front to back, looking back at most
+      // a token.
+      madvise(mapping, size_, MADV_SEQUENTIAL);
+      mapping_ = static_cast<const char *>(mapping);
+      return true;
+    }
+  }
+
+  fd_ = fd;
+  // Every chunk must be able to hold a whole UTF-8 character.
+  buffer_.resize(std::max<uint32_t>(chunk_size, 4));
+  return true;
+}
+
+void FileInput::close() {
+  if (mapping_) munmap(const_cast<char *>(mapping_), size_);
+  if (fd_ >= 0) ::close(fd_);
+  mapping_ = NULL;
+  fd_ = -1;
+  size_ = 0;
+  buffer_start_ = 0;
+  buffer_length_ = 0;
+  read_count_ = 0;
+  copied_bytes_ = 0;
+}
+
+const char *FileInput::read(void *payload, uint32_t byte, TSPoint, uint32_t *bytes_read) {
+  FileInput *self = static_cast<FileInput *>(payload);
+  self->read_count_++;
+  if (byte >= self->size_) {
+    *bytes_read = 0;
+    return "";
+  }
+  if (self->mapping_) {
+    *bytes_read = self->size_ - byte;
+    return self->mapping_ + byte;
+  }
+
+  // The lexer asks for the same chunk again when it resets to the start of
+  // the last one; serve that from the buffer. Any other position is read
+  // again, and so is a buffer that ends less than a UTF-8 character short of
+  // the end of the file: the lexer asks for a fresh chunk at a character
+  // that a chunk cut in two, and needs to be handed all of it.
+  uint32_t buffer_end = self->buffer_start_ + self->buffer_length_;
+  if (byte != self->buffer_start_ || self->buffer_length_ == 0 ||
+      (self->buffer_length_ < 4 && buffer_end < self->size_)) {
+    uint32_t wanted = std::min<uint32_t>(self->buffer_.size(), self->size_ - byte);
+    ssize_t length;
+    do {
+      length = pread(self->fd_, self->buffer_.data(), wanted, byte);
+    } while (length < 0 && errno == EINTR);
+    if (length <= 0) {
+      // The file shrank or cannot be read any more; end the input here.
+      *bytes_read = 0;
+      return "";
+    }
+    self->buffer_start_ = byte;
+    self->buffer_length_ = length;
+    self->copied_bytes_ += length;
+  }
+  *bytes_read = self->buffer_start_ + self->buffer_length_ - byte;
+  return self->buffer_.data() + (byte - self->buffer_start_);
+}
+
+}
@@ -0,0 +1,68 @@
+#ifndef TREE_SITTER_BLADE_TOOLS_FILE_INPUT_H_
+#define TREE_SITTER_BLADE_TOOLS_FILE_INPUT_H_
+
+// A template file handed to the parser as a TSInput, without reading it into
+// a string first.
+//
+// The file is memory-mapped and every read is answered with a pointer into
+// the mapping, so the source is never copied and the only memory it takes
+// is page cache, which the kernel can drop and read again at will. Files
+// that cannot be mapped (on some network and FUSE file systems) are read
+// with pread into one fixed-size buffer instead, so that they also need
+// constant extra memory however large they are. Either way the file must be
+// smaller than 4 GB, the most a tree can span, and must not be truncated
+// while it is being parsed.
+
+#include "common.h"
+
+namespace tools {
+
+class FileInput {
+ public:
+  static const uint32_t DEFAULT_CHUNK_SIZE = 64 * 1024;
+
+  FileInput() = default;
+  ~FileInput() { close(); }
+
+  FileInput(const FileInput &) = delete;
+  FileInput &operator=(const FileInput &) = delete;
+
+  // Opens `path`, closing any file opened before. With `map` false, the file
+  // is read with pread even if it could be mapped, `chunk_size` bytes (at
+  // least 4) at a time. Returns false if the file cannot be opened or is too
+  // large.
+  bool open(const string &path, bool map = true, uint32_t chunk_size = DEFAULT_CHUNK_SIZE);
+  void close();
+
+  uint32_t size() const { return size_; }
+
+  // Whether the file is mapped (or empty) rather than read in chunks.
+  bool mapped() const { return fd_ < 0; }
+
+  // The whole file if it is mapped, NULL if it is read in chunks.
+  const char *data() const { return fd_ >= 0 ? NULL : mapping_ ? mapping_ : ""; }
+
+  // Valid until the file is closed; the parser must be done with it by then.
+  TSInput input() { return TSInput{this, &FileInput::read, TSInputEncodingUTF8}; }
+
+  // How many times the parser asked for more of the file, and how many
+  // bytes were copied into the buffer for it (always 0 when mapped).
+  uint64_t read_count() const { return read_count_; }
+  uint64_t copied_bytes() const { return copied_bytes_; }
+
+ private:
+  static const char *read(void *payload, uint32_t byte, TSPoint position, uint32_t *bytes_read);
+
+  int fd_ = -1;
+  const char *mapping_ = NULL;
+  uint32_t size_ = 0;
+  vector<char> buffer_;
+  uint32_t buffer_start_ = 0;
+  uint32_t buffer_length_ = 0;
+  uint64_t read_count_ = 0;
+  uint64_t copied_bytes_ = 0;
+};
+
+}
+
+#endif  // TREE_SITTER_BLADE_TOOLS_FILE_INPUT_H_
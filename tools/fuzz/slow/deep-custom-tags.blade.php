@@ -0,0 +1 @@
+<x-item-0><x-item-1><x-item-2><x-item-3><x-item-4><x-item-5><x-item-6><x-item-7><x-item-8><x-item-9><x-item-10><x-item-11><x-item-12><x-item-13><x-item-14><x-item-15><x-item-16><x-item-17><x-item-18><x-item-19><x-item-20><x-item-21><x-item-22><x-item-23><x-item-24><x-item-25><x-item-26><x-item-27><x-item-28><x-item-29><x-item-30><x-item-31><x-item-32><x-item-33><x-item-34><x-item-35><x-item-36><x-item-37><x-item-38><x-item-39><x-item-40><x-item-41><x-item-42><x-item-43><x-item-44><x-item-45><x-item-46><x-item-47><x-item-48><x-item-49><x-item-0><x-item-1><x-item-2><x-item-3><x-item-4><x-item-5><x-item-6><x-item-7><x-item-8><x-item-9><x-item-10><x-item-11><x-item-12><x-item-13><x-item-14><x-item-15><x-item-16><x-item-17><x-item-18><x-item-19><x-item-20><x-item-21><x-item-22><x-item-23><x-item-24><x-item-25><x-item-26><x-item-27><x-item-28><x-item-29><x-item-30><x-item-31><x-item-32><x-item-33><x-item-34><x-item-35><x-item-36><x-item-37><x-item-38><x-item-39><x-item-40><x-item-41><x-item-42><x-item-43><x-item-44><x-item-45><x-item-46><x-item-47><x-item-48><x-item-49><x-item-0><x-item-1><x-item-2><x-item-3><x-item-4><x-item-5><x-item-6><x-item-7><x-item-8><x-item-9><x-item-10><x-item-11><x-item-12><x-item-13><x-item-14><x-item-15><x-item-16><x-item-17><x-item-18><x-item-19><x-item-20><x-item-21><x-item-22><x-item-23><x-item-24><x-item-25><x-item-26><x-item-27><x-item-28><x-item-29><x-item-30><x-item-31><x-item-32><x-item-33><x-item-34><x-item-35><x-item-36><x-item-37><x-item-38><x-item-39><x-item-40><x-item-41><x-item-42><x-item-43><x-item-44><x-item-45><x-item-46><x-item-47><x-item-48><x-item-49><x-item-0><x-item-1><x-item-2><x-item-3><x-item-4><x-item-5><x-item-6><x-item-7><x-item-8><x-item-9><x-item-10><x-item-11><x-item-12><x-item-13><x-item-14><x-item-15><x-item-16><x-item-17><x-item-18><x-item-19><x-item-20><x-item-21><x-item-22><x-item-23><x-item-24><x-item-25><x-item-26><x-item-27><x-item-28><x-item-29><x-item-30><x-item-31><x-item-32><x-item-33><x-item-34><x-item-35><x-item-36><x-item-37><x-item-38><x-item-39><x-item-40><x-item-41><x-item-42><x-item-43><x-item-44><x-item-45><x-item-46><x-item-47><x-item-48><x-item-49><x-item-0><x-item-1><x-item-2><x-item-3><x-item-4><x-item-5><x-item-6><x-item-7><x-item-8><x-item-9><x-item-10><x-item-11><x-item-12><x-item-13><x-item-14><x-item-15><x-item-16><x-item-17><x-item-18><x-item-19><x-item-20><x-item-21><x-item-22><x-item-23><x-item-24><x-item-25><x-item-26><x-item-27><x-item-28><x-item-29><x-item-30><x-item-31><x-item-32><x-item-33><x-item-34><x-item-35><x-item-36><x-item-37><x-item-38><x-item-39><x-item-40><x-item-41><x-item-42><x-item-43><x-item-44><x-item-45><x-item-46><x-item-47><x-item-48><x-item-49><x-item-0><x-item-1><x-item-2><x-item-3><x-item-4><x-item-5><x-item-6><x-item-7><x-item-8><x-item-9><x-item-10><x-item-11><x-item-12><x-item-13><x-item-14><x-item-15><x-item-16><x-item-17><x-item-18><x-item-19><x-item-20><x-item-21><x-item-22><x-item-23><x-item-24><x-item-25><x-item-26><x-item-27><x-item-28><x-item-29><x-item-30><x-item-31><x-item-32><x-item-33><x-item-34><x-item-35><x-item-36><x-item-37><x-item-38><x-item-39><x-item-40><x-item-41><x-item-42><x-item-43><x-item-44><x-item-45><x-item-46><x-item-47><x-item-48><x-item-49><x-item-0><x-item-1><x-item-2><x-item-3><x-item-4><x-item-5><x-item-6><x-item-7><x-item-8><x-item-9><x-item-10><x-item-11><x-item-12><x-item-13><x-item-14><x-item-15><x-item-16><x-item-17><x-item-18><x-item-19><x-item-20><x-item-21><x-item-22><x-item-23><x-item-24><x-item-25><x-item-26><x-item-27><x-item-28><x-item-29><x-item-30><x-item-31><x-item-32><x-item-33><x-item-34><x-item-35><x-item-36><x-item-37><x-item-38><x-item-39><x-item-40><x-item-41><x-item-42><x-item-43><x-item-44><x-item-45><x-item-46><x-item-47><x-item-48><x-item-49><x-item-0><x-item-1><x-item-2><x-item-3><x-item-4><x-item-5><x-item-6><x-item-7><x-item-8><x-item-9><x-item-10><x-item-11><x-item-12><x-item-13><x-item-14><x-item-15><x-item-16><x-item-17><x-item-18><x-item-19><x-item-20><x-item-21><x-item-22><x-item-23><x-item-24><x-item-25><x-item-26><x-item-27><x-item-28><x-item-29><x-item-30><x-item-31><x-item-32><x-item-33><x-item-34><x-item-35><x-item-36><x-item-37><x-item-38><x-item-39><x-item-40><x-item-41><x-item-42><x-item-43><x-item-44><x-item-45><x-item-46><x-item-47><x-item-48><x-item-49><x-item-0><x-item-1><x-item-2><x-item-3><x-item-4><x-item-5><x-item-6><x-item-7><x-item-8><x-item-9><x-item-10><x-item-11><x-item-12><x-item-13><x-item-14><x-item-15><x-item-16><x-item-17><x-item-18><x-item-19><x-item-20><x-item-21><x-item-22><x-item-23><x-item-24><x-item-25><x-item-26><x-item-27><x-item-28><x-item-29><x-item-30><x-item-31><x-item-32><x-item-33><x-item-34><x-item-35><x-item-36><x-item-37><x-item-38><x-item-39><x-item-40><x-item-41><x-item-42><x-item-43><x-item-44><x-item-45><x-item-46><x-item-47><x-item-48><x-item-49><x-item-0><x-item-1><x-item-2><x-item-3><x-item-4><x-item-5><x-item-6><x-item-7><x-item-8><x-item-9><x-item-10><x-item-11><x-item-12><x-item-13><x-item-14><x-item-15><x-item-16><x-item-17><x-item-18><x-item-19><x-item-20><x-item-21><x-item-22><x-item-23><x-item-24><x-item-25><x-item-26><x-item-27><x-item-28><x-item-29><x-item-30><x-item-31><x-item-32><x-item-33><x-item-34><x-item-35><x-item-36><x-item-37><x-item-38><x-item-39><x-item-40><x-item-41><x-item-42><x-item-43><x-item-44><x-item-45><x-item-46><x-item-47><x-item-48><x-item-49><x-item-0><x-item-1><x-item-2><x-item-3><x-item-4><x-item-5><x-item-6><x-item-7><x-item-8><x-item-9><x-item-10><x-item-11><x-item-12><x-item-13><x-item-14><x-item-15><x-item-16><x-item-17><x-item-18><x-item-19><x-item-20><x-item-21><x-item-22><x-item-23><x-item-24><x-item-25><x-item-26><x-item-27><x-item-28><x-item-29><x-item-30><x-item-31><x-item-32><x-item-33><x-item-34><x-item-35><x-item-36><x-item-37><x-item-38><x-item-39><x-item-40><x-item-41><x-item-42><x-item-43><x-item-44><x-item-45><x-item-46><x-item-47><x-item-48><x-item-49><x-item-0><x-item-1><x-item-2><x-item-3><x-item-4><x-item-5><x-item-6><x-item-7><x-item-8><x-item-9><x-item-10><x-item-11><x-item-12><x-item-13><x-item-14><x-item-15><x-item-16><x-item-17><x-item-18><x-item-19><x-item-20><x-item-21><x-item-22><x-item-23><x-item-24><x-item-25><x-item-26><x-item-27><x-item-28><x-item-29><x-item-30><x-item-31><x-item-32><x-item-33><x-item-34><x-item-35><x-item-36><x-item-37><x-item-38><x-item-39><x-item-40><x-item-41><x-item-42><x-item-43><x-item-44><x-item-45><x-item-46><x-item-47><x-item-48><x-item-49><x-item-0><x-item-1><x-item-2><x-item-3><x-item-4><x-item-5><x-item-6><x-item-7><x-item-8><x-item-9><x-item-10><x-item-11><x-item-12><x-item-13><x-item-14><x-item-15><x-item-16><x-item-17><x-item-18><x-item-19><x-item-20><x-item-21><x-item-22><x-item-23><x-item-24><x-item-25><x-item-26><x-item-27><x-item-28><x-item-29><x-item-30><x-item-31><x-item-32><x-item-33><x-item-34><x-item-35><x-item-36><x-item-37><x-item-38><x-item-39><x-item-40><x-item-41><x-item-42><x-item-43><x-item-44><x-item-45><x-item-46><x-item-47><x-item-48><x-item-49><x-item-0><x-item-1><x-item-2><x-item-3><x-item-4><x-item-5><x-item-6><x-item-7><x-item-8><x-item-9><x-item-10><x-item-11><x-item-12><x-item-13><x-item-14><x-item-15><x-item-16><x-item-17><x-item-18><x-item-19><x-item-20><x-item-21><x-item-22><x-item-23><x-item-24><x-item-25><x-item-26><x-item-27><x-item-28><x-item-29><x-item-30><x-item-31><x-item-32><x-item-33><x-item-34><x-item-35><x-item-36><x-item-37><x-item-38><x-item-39><x-item-40><x-item-41><x-item-42><x-item-43><x-item-44><x-item-45><x-item-46><x-item-47><x-item-48><x-item-49><x-item-0><x-item-1><x-item-2><x-item-3><x-item-4><x-item-5><x-item-6><x-item-7><x-item-8><x-item-9><x-item-10><x-item-11><x-item-12><x-item-13><x-item-14><x-item-15><x-item-16><x-item-17><x-item-18><x-item-19><x-item-20><x-item-21><x-item-22><x-item-23><x-item-24><x-item-25><x-item-26><x-item-27><x-item-28><x-item-29><x-item-30><x-item-31><x-item-32><x-item-33><x-item-34><x-item-35><x-item-36><x-item-37><x-item-38><x-item-39><x-item-40><x-item-41><x-item-42><x-item-43><x-item-44><x-item-45><x-item-46><x-item-47><x-item-48><x-item-49><x-item-0><x-item-1><x-item-2><x-item-3><x-item-4><x-item-5><x-item-6><x-item-7><x-item-8><x-item-9><x-item-10><x-item-11><x-item-12><x-item-13><x-item-14><x-item-15><x-item-16><x-item-17><x-item-18><x-item-19><x-item-20><x-item-21><x-item-22><x-item-23><x-item-24><x-item-25><x-item-26><x-item-27><x-item-28><x-item-29><x-item-30><x-item-31><x-item-32><x-item-33><x-item-34><x-item-35><x-item-36><x-item-37><x-item-38><x-item-39><x-item-40><x-item-41><x-item-42><x-item-43><x-item-44><x-item-45><x-item-46><x-item-47><x-item-48><x-item-49><x-item-0><x-item-1><x-item-2><x-item-3><x-item-4><x-item-5><x-item-6><x-item-7><x-item-8><x-item-9><x-item-10><x-item-11><x-item-12><x-item-13><x-item-14><x-item-15><x-item-16><x-item-17><x-item-18><x-item-19><x-item-20><x-item-21><x-item-22><x-item-23><x-item-24><x-item-25><x-item-26><x-item-27><x-item-28><x-item-29><x-item-30><x-item-31><x-item-32><x-item-33><x-item-34><x-item-35><x-item-36><x-item-37><x-item-38><x-item-39><x-item-40><x-item-41><x-item-42><x-item-43><x-item-44><x-item-45><x-item-46><x-item-47><x-item-48><x-item-49><x-item-0><x-item-1><x-item-2><x-item-3><x-item-4><x-item-5><x-item-6><x-item-7><x-item-8><x-item-9><x-item-10><x-item-11><x-item-12><x-item-13><x-item-14><x-item-15><x-item-16><x-item-17><x-item-18><x-item-19><x-item-20><x-item-21><x-item-22><x-item-23><x-item-24><x-item-25><x-item-26><x-item-27><x-item-28><x-item-29><x-item-30><x-item-31><x-item-32><x-item-33><x-item-34><x-item-35><x-item-36><x-item-37><x-item-38><x-item-39><x-item-40><x-item-41><x-item-42><x-item-43><x-item-44><x-item-45><x-item-46><x-item-47><x-item-48><x-item-49><x-item-0><x-item-1><x-item-2><x-item-3><x-item-4><x-item-5><x-item-6><x-item-7><x-item-8><x-item-9><x-item-10><x-item-11><x-item-12><x-item-13><x-item-14><x-item-15><x-item-16><x-item-17><x-item-18><x-item-19><x-item-20><x-item-21><x-item-22><x-item-23><x-item-24><x-item-25><x-item-26><x-item-27><x-item-28><x-item-29><x-item-30><x-item-31><x-item-32><x-item-33><x-item-34><x-item-35><x-item-36><x-item-37><x-item-38><x-item-39><x-item-40><x-item-41><x-item-42><x-item-43><x-item-44><x-item-45><x-item-46><x-item-47><x-item-48><x-item-49><x-item-0><x-item-1><x-item-2><x-item-3><x-item-4><x-item-5><x-item-6><x-item-7><x-item-8><x-item-9><x-item-10><x-item-11><x-item-12><x-item-13><x-item-14><x-item-15><x-item-16><x-item-17><x-item-18><x-item-19><x-item-20><x-item-21><x-item-22><x-item-23><x-item-24><x-item-25><x-item-26><x-item-27><x-item-28><x-item-29><x-item-30><x-item-31><x-item-32><x-item-33><x-item-34><x-item-35><x-item-36><x-item-37><x-item-38><x-item-39><x-item-40><x-item-41><x-item-42><x-item-43><x-item-44><x-item-45><x-item-46><x-item-47><x-item-48><x-item-49><x-item-0><x-item-1><x-item-2><x-item-3><x-item-4><x-item-5><x-item-6><x-item-7><x-item-8><x-item-9><x-item-10><x-item-11><x-item-12><x-item-13><x-item-14><x-item-15><x-item-16><x-item-17><x-item-18><x-item-19><x-item-20><x-item-21><x-item-22><x-item-23><x-item-24><x-item-25><x-item-26><x-item-27><x-item-28><x-item-29><x-item-30><x-item-31><x-item-32><x-item-33><x-item-34><x-item-35><x-item-36><x-item-37><x-item-38><x-item-39><x-item-40><x-item-41><x-item-42><x-item-43><x-item-44><x-item-45><x-item-46><x-item-47><x-item-48><x-item-49><x-item-0><x-item-1><x-item-2><x-item-3><x-item-4><x-item-5><x-item-6><x-item-7><x-item-8><x-item-9><x-item-10><x-item-11><x-item-12><x-item-13><x-item-14><x-item-15><x-item-16><x-item-17><x-item-18><x-item-19><x-item-20><x-item-21><x-item-22><x-item-23><x-item-24><x-item-25><x-item-26><x-item-27><x-item-28><x-item-29><x-item-30><x-item-31><x-item-32><x-item-33><x-item-34><x-item-35><x-item-36><x-item-37><x-item-38><x-item-39><x-item-40><x-item-41><x-item-42><x-item-43><x-item-44><x-item-45><x-item-46><x-item-47><x-item-48><x-item-49><x-item-0><x-item-1><x-item-2><x-item-3><x-item-4><x-item-5><x-item-6><x-item-7><x-item-8><x-item-9><x-item-10><x-item-11><x-item-12><x-item-13><x-item-14><x-item-15><x-item-16><x-item-17><x-item-18><x-item-19><x-item-20><x-item-21><x-item-22><x-item-23><x-item-24><x-item-25><x-item-26><x-item-27><x-item-28><x-item-29><x-item-30><x-item-31><x-item-32><x-item-33><x-item-34><x-item-35><x-item-36><x-item-37><x-item-38><x-item-39><x-item-40><x-item-41><x-item-42><x-item-43><x-item-44><x-item-45><x-item-46><x-item-47><x-item-48><x-item-49><x-item-0><x-item-1><x-item-2><x-item-3><x-item-4><x-item-5><x-item-6><x-item-7><x-item-8><x-item-9><x-item-10><x-item-11><x-item-12><x-item-13><x-item-14><x-item-15><x-item-16><x-item-17><x-item-18><x-item-19><x-item-20><x-item-21><x-item-22><x-item-23><x-item-24><x-item-25><x-item-26><x-item-27><x-item-28><x-item-29><x-item-30><x-item-31><x-item-32><x-item-33><x-item-34><x-item-35><x-item-36><x-item-37><x-item-38><x-item-39><x-item-40><x-item-41><x-item-42><x-item-43><x-item-44><x-item-45><x-item-46><x-item-47><x-item-48><x-item-49><x-item-0><x-item-1><x-item-2><x-item-3><x-item-4><x-item-5><x-item-6><x-item-7><x-item-8><x-item-9><x-item-10><x-item-11><x-item-12><x-item-13><x-item-14><x-item-15><x-item-16><x-item-17><x-item-18><x-item-19><x-item-20><x-item-21><x-item-22><x-item-23><x-item-24><x-item-25><x-item-26><x-item-27><x-item-28><x-item-29><x-item-30><x-item-31><x-item-32><x-item-33><x-item-34><x-item-35><x-item-36><x-item-37><x-item-38><x-item-39><x-item-40><x-item-41><x-item-42><x-item-43><x-item-44><x-item-45><x-item-46><x-item-47><x-item-48><x-item-49><x-item-0><x-item-1><x-item-2><x-item-3><x-item-4><x-item-5><x-item-6><x-item-7><x-item-8><x-item-9><x-item-10><x-item-11><x-item-12><x-item-13><x-item-14><x-item-15><x-item-16><x-item-17><x-item-18><x-item-19><x-item-20><x-item-21><x-item-22><x-item-23><x-item-24><x-item-25><x-item-26><x-item-27><x-item-28><x-item-29><x-item-30><x-item-31><x-item-32><x-item-33><x-item-34><x-item-35><x-item-36><x-item-37><x-item-38><x-item-39><x-item-40><x-item-41><x-item-42><x-item-43><x-item-44><x-item-45><x-item-46><x-item-47><x-item-48><x-item-49><x-item-0><x-item-1><x-item-2><x-item-3><x-item-4><x-item-5><x-item-6><x-item-7><x-item-8><x-item-9><x-item-10><x-item-11><x-item-12><x-item-13><x-item-14><x-item-15><x-item-16><x-item-17><x-item-18><x-item-19><x-item-20><x-item-21><x-item-22><x-item-23><x-item-24><x-item-25><x-item-26><x-item-27><x-item-28><x-item-29><x-item-30><x-item-31><x-item-32><x-item-33><x-item-34><x-item-35><x-item-36><x-item-37><x-item-38><x-item-39><x-item-40><x-item-41><x-item-42><x-item-43><x-item-44><x-item-45><x-item-46><x-item-47><x-item-48><x-item-49><x-item-0><x-item-1><x-item-2><x-item-3><x-item-4><x-item-5><x-item-6><x-item-7><x-item-8><x-item-9><x-item-10><x-item-11><x-item-12><x-item-13><x-item-14><x-item-15><x-item-16><x-item-17><x-item-18><x-item-19><x-item-20><x-item-21><x-item-22><x-item-23><x-item-24><x-item-25><x-item-26><x-item-27><x-item-28><x-item-29><x-item-30><x-item-31><x-item-32><x-item-33><x-item-34><x-item-35><x-item-36><x-item-37><x-item-38><x-item-39><x-item-40><x-item-41><x-item-42><x-item-43><x-item-44><x-item-45><x-item-46><x-item-47><x-item-48><x-item-49><x-item-0><x-item-1><x-item-2><x-item-3><x-item-4><x-item-5><x-item-6><x-item-7><x-item-8><x-item-9><x-item-10><x-item-11><x-item-12><x-item-13><x-item-14><x-item-15><x-item-16><x-item-17><x-item-18><x-item-19><x-item-20><x-item-21><x-item-22><x-item-23><x-item-24><x-item-25><x-item-26><x-item-27><x-item-28><x-item-29><x-item-30><x-item-31><x-item-32><x-item-33><x-item-34><x-item-35><x-item-36><x-item-37><x-item-38><x-item-39><x-item-40><x-item-41><x-item-42><x-item-43><x-item-44><x-item-45><x-item-46><x-item-47><x-item-48><x-item-49><x-item-0><x-item-1><x-item-2><x-item-3><x-item-4><x-item-5><x-item-6><x-item-7><x-item-8><x-item-9><x-item-10><x-item-11><x-item-12><x-item-13><x-item-14><x-item-15><x-item-16><x-item-17><x-item-18><x-item-19><x-item-20><x-item-21><x-item-22><x-item-23><x-item-24><x-item-25><x-item-26><x-item-27><x-item-28><x-item-29><x-item-30><x-item-31><x-item-32><x-item-33><x-item-34><x-item-35><x-item-36><x-item-37><x-item-38><x-item-39><x-item-40><x-item-41><x-item-42><x-item-43><x-item-44><x-item-45><x-item-46><x-item-47><x-item-48><x-item-49><x-item-0><x-item-1><x-item-2><x-item-3><x-item-4><x-item-5><x-item-6><x-item-7><x-item-8><x-item-9><x-item-10><x-item-11><x-item-12><x-item-13><x-item-14><x-item-15><x-item-16><x-item-17><x-item-18><x-item-19><x-item-20><x-item-21><x-item-22><x-item-23><x-item-24><x-item-25><x-item-26><x-item-27><x-item-28><x-item-29><x-item-30><x-item-31><x-item-32><x-item-33><x-item-34><x-item-35><x-item-36><x-item-37><x-item-38><x-item-39><x-item-40><x-item-41><x-item-42><x-item-43><x-item-44><x-item-45><x-item-46><x-item-47><x-item-48><x-item-49><x-item-0><x-item-1><x-item-2><x-item-3><x-item-4><x-item-5><x-item-6><x-item-7><x-item-8><x-item-9><x-item-10><x-item-11><x-item-12><x-item-13><x-item-14><x-item-15><x-item-16><x-item-17><x-item-18><x-item-19><x-item-20><x-item-21><x-item-22><x-item-23><x-item-24><x-item-25><x-item-26><x-item-27><x-item-28><x-item-29><x-item-30><x-item-31><x-item-32><x-item-33><x-item-34><x-item-35><x-item-36><x-item-37><x-item-38><x-item-39><x-item-40><x-item-41><x-item-42><x-item-43><x-item-44><x-item-45><x-item-46><x-item-47><x-item-48><x-item-49><x-item-0><x-item-1><x-item-2><x-item-3><x-item-4><x-item-5><x-item-6><x-item-7><x-item-8><x-item-9><x-item-10><x-item-11><x-item-12><x-item-13><x-item-14><x-item-15><x-item-16><x-item-17><x-item-18><x-item-19><x-item-20><x-item-21><x-item-22><x-item-23><x-item-24><x-item-25><x-item-26><x-item-27><x-item-28><x-item-29><x-item-30><x-item-31><x-item-32><x-item-33><x-item-34><x-item-35><x-item-36><x-item-37><x-item-38><x-item-39><x-item-40><x-item-41><x-item-42><x-item-43><x-item-44><x-item-45><x-item-46><x-item-47><x-item-48><x-item-49><x-item-0><x-item-1><x-item-2><x-item-3><x-item-4><x-item-5><x-item-6><x-item-7><x-item-8><x-item-9><x-item-10><x-item-11><x-item-12><x-item-13><x-item-14><x-item-15><x-item-16><x-item-17><x-item-18><x-item-19><x-item-20><x-item-21><x-item-22><x-item-23><x-item-24><x-item-25><x-item-26><x-item-27><x-item-28><x-item-29><x-item-30><x-item-31><x-item-32><x-item-33><x-item-34><x-item-35><x-item-36><x-item-37><x-item-38><x-item-39><x-item-40><x-item-41><x-item-42><x-item-43><x-item-44><x-item-45><x-item-46><x-item-47><x-item-48><x-item-49><x-item-0><x-item-1><x-item-2><x-item-3><x-item-4><x-item-5><x-item-6><x-item-7><x-item-8><x-item-9><x-item-10><x-item-11><x-item-12><x-item-13><x-item-14><x-item-15><x-item-16><x-item-17><x-item-18><x-item-19><x-item-20><x-item-21><x-item-22><x-item-23><x-item-24><x-item-25><x-item-26><x-item-27><x-item-28><x-item-29><x-item-30><x-item-31><x-item-32><x-item-33><x-item-34><x-item-35><x-item-36><x-item-37><x-item-38><x-item-39><x-item-40><x-item-41><x-item-42><x-item-43><x-item-44><x-item-45><x-item-46><x-item-47><x-item-48><x-item-49><x-item-0><x-item-1><x-item-2><x-item-3><x-item-4><x-item-5><x-item-6><x-item-7><x-item-8><x-item-9><x-item-10><x-item-11><x-item-12><x-item-13><x-item-14><x-item-15><x-item-16><x-item-17><x-item-18><x-item-19><x-item-20><x-item-21><x-item-22><x-item-23><x-item-24><x-item-25><x-item-26><x-item-27><x-item-28><x-item-29><x-item-30><x-item-31><x-item-32><x-item-33><x-item-34><x-item-35><x-item-36><x-item-37><x-item-38><x-item-39><x-item-40><x-item-41><x-item-42><x-item-43><x-item-44><x-item-45><x-item-46><x-item-47><x-item-48><x-item-49><x-item-0><x-item-1><x-item-2><x-item-3><x-item-4><x-item-5><x-item-6><x-item-7><x-item-8><x-item-9><x-item-10><x-item-11><x-item-12><x-item-13><x-item-14><x-item-15><x-item-16><x-item-17><x-item-18><x-item-19><x-item-20><x-item-21><x-item-22><x-item-23><x-item-24><x-item-25><x-item-26><x-item-27><x-item-28><x-item-29><x-item-30><x-item-31><x-item-32><x-item-33><x-item-34><x-item-35><x-item-36><x-item-37><x-item-38><x-item-39><x-item-40><x-item-41><x-item-42><x-item-43><x-item-44><x-item-45><x-item-46><x-item-47><x-item-48><x-item-49><x-item-0><x-item-1><x-item-2><x-item-3><x-item-4><x-item-5><x-item-6><x-item-7><x-item-8><x-item-9><x-item-10><x-item-11><x-item-12><x-item-13><x-item-14><x-item-15><x-item-16><x-item-17><x-item-18><x-item-19><x-item-20><x-item-21><x-item-22><x-item-23><x-item-24><x-item-25><x-item-26><x-item-27><x-item-28><x-item-29><x-item-30><x-item-31><x-item-32><x-item-33><x-item-34><x-item-35><x-item-36><x-item-37><x-item-38><x-item-39><x-item-40><x-item-41><x-item-42><x-item-43><x-item-44><x-item-45><x-item-46><x-item-47><x-item-48><x-item-49><x-item-0><x-item-1><x-item-2><x-item-3><x-item-4><x-item-5><x-item-6><x-item-7><x-item-8><x-item-9><x-item-10><x-item-11><x-item-12><x-item-13><x-item-14><x-item-15><x-item-16><x-item-17><x-item-18><x-item-19><x-item-20><x-item-21><x-item-22><x-item-23><x-item-24><x-item-25><x-item-26><x-item-27><x-item-28><x-item-29><x-item-30><x-item-31><x-item-32><x-item-33><x-item-34><x-item-35><x-item-36><x-item-37><x-item-38><x-item-39><x-item-40><x-item-41><x-item-42><x-item-43><x-item-44><x-item-45><x-item-46><x-item-47><x-item-48><x-item-49><x-item-0><x-item-1><x-item-2><x-item-3><x-item-4><x-item-5><x-item-6><x-item-7><x-item-8><x-item-9><x-item-10><x-item-11><x-item-12><x-item-13><x-item-14><x-item-15><x-item-16><x-item-17><x-item-18><x-item-19><x-item-20><x-item-21><x-item-22><x-item-23><x-item-24><x-item-25><x-item-26><x-item-27><x-item-28><x-item-29><x-item-30><x-item-31><x-item-32><x-item-33><x-item-34><x-item-35><x-item-36><x-item-37><x-item-38><x-item-39><x-item-40><x-item-41><x-item-42><x-item-43><x-item-44><x-item-45><x-item-46><x-item-47><x-item-48><x-item-49>
\ No newline at end of file
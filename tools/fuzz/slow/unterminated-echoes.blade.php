@@ -0,0 +1,1500 @@
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
+<div>{{ $a
@@ -0,0 +1,128 @@
+// Fuzz target that looks for inputs on which parsing is super-linear.
+//
+// Built with libFuzzer (`make fuzz-scanner`, needs clang), every input is
+// parsed and the run aborts when the external scanner does too much work for
+// its size. Work is counted, not timed, so that the verdict is the same on
+// every machine and under sanitizers: an input fails when
+//
+//   - the scanner advances the lexer more than BLADE_FUZZ_MAX_ADVANCES_PER_BYTE
+//     times per input byte, or
+//   - for inputs of at least MIN_GROWTH_BYTES, the scan calls and advances for
+//     the whole input are more than BLADE_FUZZ_MAX_GROWTH times those for its
+//     first half. Linear parsing gives about 2, quadratic parsing 4, so this
+//     does not depend on the constant factors of any particular input.
+//
+// Both limits can be overridden through environment variables of the same
+// name. A slow input that the fuzzer finds is minimized and added to
+// tools/fuzz/slow/ once the scanner is fixed:
+//
+//   fuzz-scanner -minimize_crash=1 -runs=100000 crash-<sha1>
+//   fuzz-scanner -merge=1 fuzz/slow minimized-from-<sha1>
+//
+// An input that failed the growth check stays at least MIN_GROWTH_BYTES long
+// when minimized, since below that size it would no longer fail. The cases
+// in the corpus today are all hand-written, not found by the fuzzer: they
+// scale up the scanner's known hot spots (deep custom tags, implicit end
+// tags, `{{` with no closer, which the raw echo scan reads to the end of the
+// file).
+//
+// Without libFuzzer (`make fuzz-regressions`) the same check runs over the
+// files given on the command line, which is how the slow corpus is replayed
+// by `make fuzz-check`. There a file shorter than MIN_GROWTH_BYTES fails too:
+// only the per-byte limit would apply to it, and that cannot tell a quadratic
+// scan from an expensive linear one.
+
+#include "common.h"
+
+using namespace tools;
+
+namespace {
+
+// Below this size the per-parse overhead hides the growth of the work.
+const size_t MIN_GROWTH_BYTES = 1024;
+
+double limit_from_env(const char *name, double fallback) {
+  const char *value = getenv(name);
+  return value ? atof(value) : fallback;
+}
+
+const double MAX_ADVANCES_PER_BYTE = limit_from_env("BLADE_FUZZ_MAX_ADVANCES_PER_BYTE", 32);
+const double MAX_GROWTH = limit_from_env("BLADE_FUZZ_MAX_GROWTH", 3);
+
+TSParser *parser() {
+  static TSParser *parser = NULL;
+  if (!parser) {
+    parser = ts_parser_new();
+    ts_parser_set_language(parser, instrument_scanner());
+  }
+  return parser;
+}
+
+// Scan calls plus advances for one parse.
+uint64_t scanner_work(const uint8_t *data, size_t size) {
+  scanner_counters = ScannerCounters();
+  TSTree *tree = ts_parser_parse_string(parser(), NULL, reinterpret_cast<const char *>(data), size);
+  ts_tree_delete(tree);
+  return scanner_counters.scans + scanner_counters.advances;
+}
+
+struct Measurement {
+  double advances_per_byte;
+  double scans_per_byte;
+  double growth;
+  bool too_slow;
+};
+
+Measurement measure(const uint8_t *data, size_t size) {
+  Measurement result = {};
+  if (size >= MIN_GROWTH_BYTES) {
+    uint64_t half_work = scanner_work(data, size / 2);
+    uint64_t work = scanner_work(data, size);
+    result.growth = static_cast<double>(work) / std::max<uint64_t>(half_work, 1);
+  } else {
+    scanner_work(data, size);
+  }
+
+  size_t bytes = std::max<size_t>(size, 1);
+  result.advances_per_byte = static_cast<double>(scanner_counters.advances) / bytes;
+  result.scans_per_byte = static_cast<double>(scanner_counters.scans) / bytes;
+  result.too_slow = result.advances_per_byte > MAX_ADVANCES_PER_BYTE || result.growth > MAX_GROWTH;
+  return result;
+}
+
+}
+
+extern "C" int LLVMFuzzerTestOneInput(const uint8_t *data, size_t size) {
+  Measurement result = measure(data, size);
+  if (result.too_slow) {
+    fprintf(stderr, "super-linear input: %zu bytes, %.1f advances/byte, %.2fx work for 2x input\n",
+            size, result.advances_per_byte, result.growth);
+    abort();
+  }
+  return 0;
+}
+
+#ifndef BLADE_LIBFUZZER
+
+int main(int argc, char **argv) {
+  vector<string> paths(argv + 1, argv + argc);
+  if (paths.empty()) {
+    fprintf(stderr, "usage: fuzz-regressions PATH...\n");
+    return 1;
+  }
+
+  unsigned failures = 0;
+  for (const SourceFile &file : load_files(paths, "")) {
+    const uint8_t *data = reinterpret_cast<const uint8_t *>(file.contents.data());
+    Measurement result = measure(data, file.contents.size());
+    bool too_small = file.contents.size() < MIN_GROWTH_BYTES;
+    printf("%s %-48s %10zu bytes %8.1f advances/byte %6.1f scans/byte %6.2fx growth%s\n",
+           result.too_slow || too_small ? "FAIL" : "ok  ", file.path.c_str(), file.contents.size(),
+           result.advances_per_byte, result.scans_per_byte, result.growth,
+           too_small ? " (too small to check growth)" : "");
+    if (result.too_slow || too_small) failures++;
+  }
+  return failures ? 1 : 0;
+}
+
+#endif
@@ -0,0 +1,330 @@
+// Deterministic generator for synthetic Blade views.
+//
+//   gen-corpus [--seed N] [--size BYTES] [--files N] [--out DIR] [options]
+//
+// Writes a single view to stdout, or `--files` views of roughly `--size` bytes
+// each into `--out`. Sizes accept K, M and G suffixes. The output depends only
+// on the options and the seed, so scaling runs are reproducible across
+// machines:
+//
+//   --depth N               maximum element nesting depth (default 8)
+//   --echo-density F        chance that a node is an echo (default 0.15)
+//   --directive-density F   chance that a node is a directive (default 0.1)
+//   --component-ratio F     chance that an element is a component (default 0.1)
+//   --script-size BYTES     approximate size of each <script> body (default 512)
+//   --style-size BYTES      approximate size of each <style> body (default 256)
+//   --malformed-ratio F     chance of an unclosed or stray tag or echo (default 0)
+
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+
+using std::string;
+
+namespace {
+
+// splitmix64: small, fast and identical on every platform, unlike the
+// distributions in <random>.
+struct Random {
+  uint64_t state;
+
+  explicit Random(uint64_t seed) : state(seed) {}
+
+  uint64_t next() {
+    uint64_t z = (state += 0x9E3779B97F4A7C15ULL);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+  }
+
+  unsigned below(unsigned n) {
+    return n ? next() % n : 0;
+  }
+
+  bool chance(double p) {
+    return (next() >> 11) * (1.0 / 9007199254740992.0) < p;
+  }
+
+  template <typename T, size_t N>
+  const T &pick(const T (&items)[N]) {
+    return items[below(N)];
+  }
+};
+
+struct Options {
+  uint64_t seed = 1;
+  size_t size = 16 * 1024;
+  unsigned files = 0;
+  string out;
+  unsigned depth = 8;
+  double echo_density = 0.15;
+  double directive_density = 0.1;
+  double component_ratio = 0.1;
+  size_t script_size = 512;
+  size_t style_size = 256;
+  double malformed_ratio = 0;
+};
+
+const char *const WORDS[] = {
+  "lorem", "ipsum", "dolor", "sit", "amet", "order", "invoice", "customer",
+  "total", "welcome", "back", "settings", "profile", "logout", "search",
+  "results", "page", "of", "the", "and", "your", "account", "été", "naïve",
+};
+
+const char *const VARIABLES[] = {
+  "$user->name", "$order->total", "$item['title']", "$loop->index",
+  "__('messages.welcome')", "route('home')", "$post->created_at->diffForHumans()",
+  "number_format($price, 2)", "$errors->first('email')", "config('app.name')",
+};
+
+const char *const CONTAINER_TAGS[] = {
+  "div", "section", "article", "main", "nav", "header", "footer", "span",
+  "p", "ul", "form", "table", "label", "button", "a",
+};
+
+const char *const VOID_TAGS[] = { "br", "img", "input", "hr", "meta" };
+
+const char *const COMPONENTS[] = {
+  "x-alert", "x-button", "x-card", "x-layouts.app", "x-forms.input",
+  "x-dropdown", "x-modal", "x-nav-link",
+};
+
+const char *const SELF_CLOSING_COMPONENTS[] = {
+  "x-icon name=\"check\"", "x-avatar :user=\"$user\"", "livewire:counter",
+  "livewire:search-users :limit=\"10\"",
+};
+
+const char *const CONDITIONS[] = {
+  "$user", "auth()->check()", "count($items) > 0", "$errors->any()",
+  "session('status')", "$loop->first",
+};
+
+struct Generator {
+  const Options &options;
+  Random random;
+  string out;
+  string indent;
+
+  Generator(const Options &options, uint64_t seed) : options(options), random(seed) {}
+
+  bool malformed() {
+    return options.malformed_ratio > 0 && random.chance(options.malformed_ratio);
+  }
+
+  void line(const string &text) {
+    out += indent;
+    out += text;
+    out += '\n';
+  }
+
+  string words(unsigned count) {
+    string result;
+    for (unsigned i = 0; i < count; i++) {
+      if (i) result += ' ';
+      result += random.pick(WORDS);
+    }
+    return result;
+  }
+
+  void push_indent() {
+    indent += "  ";
+  }
+
+  void pop_indent() {
+    indent.resize(indent.size() - 2);
+  }
+
+  void echo() {
+    switch (random.below(4)) {
+      case 0: line("{!! " + string(random.pick(VARIABLES)) + " !!}"); break;
+      case 1: line("@{{ " + string(random.pick(VARIABLES)) + " }}"); break;
+      default:
+        if (malformed()) {
+          line("{{ " + string(random.pick(VARIABLES)));
+        } else {
+          line(words(random.below(4)) + " {{ " + random.pick(VARIABLES) + " }}");
+        }
+    }
+  }
+
+  void children(unsigned depth) {
+    unsigned count = 1 + random.below(5);
+    for (unsigned i = 0; i < count; i++) node(depth);
+  }
+
+  void directive(unsigned depth) {
+    switch (random.below(6)) {
+      case 0:
+        line("@if (" + string(random.pick(CONDITIONS)) + ")");
+        push_indent(); children(depth + 1); pop_indent();
+        if (random.chance(0.3)) {
+          line("@else");
+          push_indent(); children(depth + 1); pop_indent();
+        }
+        line("@endif");
+        break;
+      case 1:
+        line("@foreach ($items as $item)");
+        push_indent(); children(depth + 1); pop_indent();
+        line("@endforeach");
+        break;
+      case 2:
+        line("@include('partials." + string(random.pick(WORDS)) + "', ['item' => $item])");
+        break;
+      case 3:
+        line("@csrf");
+        break;
+      case 4:
+        line("@push('scripts')");
+        push_indent(); script(); pop_indent();
+        line("@endpush");
+        break;
+      default:
+        line("@php($count = " + std::to_string(random.below(100)) + ")");
+        break;
+    }
+  }
+
+  void raw_text(const char *tag, size_t size, const char *prefix, const char *suffix) {
+    line(string("<") + tag + ">");
+    push_indent();
+    size_t start = out.size();
+    while (out.size() - start < size) line(prefix + std::to_string(random.below(1000)) + suffix);
+    pop_indent();
+    line(string("</") + tag + ">");
+  }
+
+  void script() {
+    raw_text("script", options.script_size, "window.app.items.push(", ");");
+  }
+
+  void style() {
+    raw_text("style", options.style_size, ".item-", " { margin: 0 }");
+  }
+
+  void element(unsigned depth) {
+    if (random.chance(options.component_ratio)) {
+      if (random.chance(0.4)) {
+        line(string("<") + random.pick(SELF_CLOSING_COMPONENTS) + " />");
+        return;
+      }
+      string name = random.pick(COMPONENTS);
+      line("<" + name + " class=\"mt-" + std::to_string(random.below(8)) + "\">");
+      push_indent(); children(depth + 1); pop_indent();
+      if (!malformed()) line("</" + name + ">");
+      return;
+    }
+
+    if (random.chance(0.1)) {
+      line(string("<") + random.pick(VOID_TAGS) + " class=\"" + random.pick(WORDS) + "\">");
+      return;
+    }
+
+    string name = random.pick(CONTAINER_TAGS);
+    line("<" + name + " class=\"" + words(2) + "\">");
+    push_indent(); children(depth + 1); pop_indent();
+    if (malformed()) {
+      if (random.chance(0.5)) line("</" + string(random.pick(CONTAINER_TAGS)) + ">");
+    } else {
+      line("</" + name + ">");
+    }
+  }
+
+  void node(unsigned depth) {
+    if (random.chance(options.echo_density)) {
+      echo();
+    } else if (random.chance(options.directive_density)) {
+      directive(depth);
+    } else if (depth < options.depth && random.chance(0.6)) {
+      element(depth);
+    } else if (random.chance(0.02)) {
+      line("{{-- " + words(4) + " --}}");
+    } else {
+      line(words(1 + random.below(12)));
+    }
+  }
+
+  const string &view() {
+    line("@extends('layouts." + string(random.pick(WORDS)) + "')");
+    line("@section('content')");
+    while (out.size() < options.size) {
+      unsigned kind = random.below(40);
+      if (kind == 0) {
+        script();
+      } else if (kind == 1) {
+        style();
+      } else {
+        element(1);
+      }
+    }
+    line("@endsection");
+    return out;
+  }
+};
+
+size_t parse_size(const char *text) {
+  char *end;
+  double value = strtod(text, &end);
+  switch (*end) {
+    case 'k': case 'K': value *= 1024; break;
+    case 'm': case 'M': value *= 1024 * 1024; break;
+    case 'g': case 'G': value *= 1024 * 1024 * 1024; break;
+  }
+  return static_cast<size_t>(value);
+}
+
+void usage() {
+  fprintf(stderr,
+    "usage: gen-corpus [--seed N] [--size BYTES] [--files N --out DIR] [--depth N]\n"
+    "                  [--echo-density F] [--directive-density F] [--component-ratio F]\n"
+    "                  [--script-size BYTES] [--style-size BYTES] [--malformed-ratio F]\n");
+  exit(1);
+}
+
+}
+
+int main(int argc, char **argv) {
+  Options options;
+  for (int i = 1; i < argc; i++) {
+    string arg = argv[i];
+    if (i + 1 >= argc) usage();
+    const char *value = argv[++i];
+    if (arg == "--seed") options.seed = strtoull(value, NULL, 10);
+    else if (arg == "--size") options.size = parse_size(value);
+    else if (arg == "--files") options.files = atoi(value);
+    else if (arg == "--out") options.out = value;
+    else if (arg == "--depth") options.depth = atoi(value);
+    else if (arg == "--echo-density") options.echo_density = atof(value);
+    else if (arg == "--directive-density") options.directive_density = atof(value);
+    else if (arg == "--component-ratio") options.component_ratio = atof(value);
+    else if (arg == "--script-size") options.script_size = parse_size(value);
+    else if (arg == "--style-size") options.style_size = parse_size(value);
+    else if (arg == "--malformed-ratio") options.malformed_ratio = atof(value);
+    else usage();
+  }
+
+  if (options.files == 0) {
+    string view = Generator(options, options.seed).view();
+    fwrite(view.data(), 1, view.size(), stdout);
+    return 0;
+  }
+
+  if (options.out.empty()) usage();
+  for (unsigned i = 0; i < options.files; i++) {
+    char name[32];
+    snprintf(name, sizeof(name), "/view-%05u.blade.php", i);
+    string path = options.out + name;
+    FILE *file = fopen(path.c_str(), "wb");
+    if (!file) {
+      fprintf(stderr, "could not write %s\n", path.c_str());
+      return 1;
+    }
+    // Each file gets its own stream so that file N does not depend on how
+    // many files precede it.
+    string view = Generator(options, options.seed * 1000003 + i).view();
+    fwrite(view.data(), 1, view.size(), file);
+    fclose(file);
+  }
+  return 0;
+}
@@ -0,0 +1,188 @@
+// Checks that FileInput (file_input.h) hands the parser the same text, and so
+// the same trees, whether the file is mapped or read in chunks.
+//
+//   input-check [--chunk BYTES] [FILE...]
+//
+// Every FILE, and a generated template full of two-, three- and four-byte
+// UTF-8 characters, is read through the pread fallback with every chunk size
+// from 4 to BYTES (default 16), so that multibyte characters straddle chunk
+// boundaries at every offset. Each read is checked twice: the characters are
+// decoded the way the lexer decodes them (asking for a fresh chunk at a
+// character that the end of a chunk cut in two), and must match the file;
+// and the file is parsed, and the tree must match the one parsed from the
+// mapping. Every difference is printed; the exit status is 1 if there was
+// one.
+//
+//   make -C tools input-check
+
+#include "common.h"
+#include "file_input.h"
+
+#include <unistd.h>
+
+using namespace tools;
+
+namespace {
+
+const int32_t DECODE_ERROR = -1;
+
+// Decodes the character at the start of `bytes` like the runtime's UTF-8
+// decoder: returns its length, or 1 with DECODE_ERROR if it is malformed or
+// incomplete.
+uint32_t decode_utf8(const uint8_t *bytes, uint32_t length, int32_t *code_point) {
+  uint8_t first = bytes[0];
+  uint32_t size = first < 0x80 ? 1 : (first >> 5) == 6 ? 2 : (first >> 4) == 14 ? 3 : (first >> 3) == 30 ? 4 : 0;
+  if (size == 0 || size > length) {
+    *code_point = DECODE_ERROR;
+    return 1;
+  }
+  int32_t value = size == 1 ? first : first & (0x7f >> size);
+  for (uint32_t i = 1; i < size; i++) {
+    if ((bytes[i] & 0xc0) != 0x80) {
+      *code_point = DECODE_ERROR;
+      return 1;
+    }
+    value = (value << 6) | (bytes[i] & 0x3f);
+  }
+  *code_point = value;
+  return size;
+}
+
+// The characters of `input` as the lexer sees them: it reads a chunk, decodes
+// characters from it, and reads again at the first byte past its end. When a
+// character is cut off by the end of a chunk, it asks for a fresh chunk
+// starting at that character.
+vector<int32_t> lexer_characters(TSInput input) {
+  vector<int32_t> characters;
+  uint32_t position = 0, chunk_start = 0, chunk_size = 0;
+  const char *chunk = NULL;
+  auto read_chunk = [&] {
+    chunk_start = position;
+    chunk = input.read(input.payload, position, TSPoint{0, 0}, &chunk_size);
+  };
+  read_chunk();
+  for (;;) {
+    if (position >= chunk_start + chunk_size) read_chunk();
+    uint32_t size = chunk_start + chunk_size - position;
+    if (size == 0) break;
+    int32_t character;
+    const uint8_t *bytes = reinterpret_cast<const uint8_t *>(chunk) + (position - chunk_start);
+    uint32_t length = decode_utf8(bytes, size, &character);
+    if (character == DECODE_ERROR && size < 4) {
+      read_chunk();
+      length = decode_utf8(reinterpret_cast<const uint8_t *>(chunk), chunk_size, &character);
+    }
+    characters.push_back(character);
+    position += length;
+  }
+  return characters;
+}
+
+vector<int32_t> string_characters(const string &text) {
+  vector<int32_t> characters;
+  const uint8_t *bytes = reinterpret_cast<const uint8_t *>(text.data());
+  for (uint32_t position = 0; position < text.size();) {
+    int32_t character;
+    position += decode_utf8(bytes + position, text.size() - position, &character);
+    characters.push_back(character);
+  }
+  return characters;
+}
+
+string generated_template() {
+  string text;
+  for (int i = 0; i < 64; i++) {
+    // 1 + 2 + 3 + 4 bytes per round, so that the offsets drift through every
+    // chunk size.
+    text += "<p title=\"é€𝄞\">a" + string(i % 7, 'x') + "é€𝄞 {{ $ü }}</p>\n";
+  }
+  return text;
+}
+
+string tree_string(TSTree *tree) {
+  char *sexp = ts_node_string(ts_tree_root_node(tree));
+  string result = sexp;
+  free(sexp);
+  return result;
+}
+
+string parse(TSParser *parser, FileInput &input) {
+  TSTree *tree = ts_parser_parse(parser, NULL, input.input());
+  string result = tree_string(tree);
+  ts_tree_delete(tree);
+  return result;
+}
+
+// Checks one file; returns the number of differences.
+size_t check(TSParser *parser, const string &path, uint32_t max_chunk_size) {
+  string contents;
+  FileInput mapped;
+  if (!read_file(path, &contents) || !mapped.open(path)) {
+    fprintf(stderr, "could not read %s\n", path.c_str());
+    return 1;
+  }
+  vector<int32_t> expected_characters = string_characters(contents);
+  string expected_tree = parse(parser, mapped);
+
+  size_t differences = 0;
+  for (uint32_t chunk_size = 4; chunk_size <= max_chunk_size; chunk_size++) {
+    FileInput chunked;
+    if (!chunked.open(path, false, chunk_size)) {
+      fprintf(stderr, "could not read %s\n", path.c_str());
+      return differences + 1;
+    }
+    vector<int32_t> characters = lexer_characters(chunked.input());
+    if (characters != expected_characters) {
+      size_t i = 0;
+      while (i < characters.size() && i < expected_characters.size() && characters[i] == expected_characters[i]) i++;
+      printf("%s, %u-byte chunks: character %zu differs\n", path.c_str(), chunk_size, i);
+      differences++;
+    }
+    string tree = parse(parser, chunked);
+    if (tree != expected_tree) {
+      printf("%s, %u-byte chunks:\n  mmap:  %s\n  pread: %s\n", path.c_str(), chunk_size, expected_tree.c_str(),
+             tree.c_str());
+      differences++;
+    }
+  }
+  return differences;
+}
+
+}
+
+int main(int argc, char **argv) {
+  uint32_t max_chunk_size = 16;
+  vector<string> paths;
+  for (int i = 1; i < argc; i++) {
+    string arg = argv[i];
+    if (arg == "--chunk" && i + 1 < argc) {
+      max_chunk_size = atoi(argv[++i]);
+    } else if (arg[0] == '-') {
+      fprintf(stderr, "usage: input-check [--chunk BYTES] [FILE...]\n");
+      return 1;
+    } else {
+      paths.push_back(arg);
+    }
+  }
+
+  char generated_path[] = "/tmp/input-check-XXXXXX";
+  int fd = mkstemp(generated_path);
+  string generated = generated_template();
+  if (fd < 0 || write(fd, generated.data(), generated.size()) != ssize_t(generated.size())) {
+    fprintf(stderr, "could not write a temporary file\n");
+    return 1;
+  }
+  close(fd);
+  paths.insert(paths.begin(), generated_path);
+
+  TSParser *parser = ts_parser_new();
+  ts_parser_set_language(parser, tree_sitter_blade());
+  size_t differences = 0;
+  for (const string &path : paths) differences += check(parser, path, max_chunk_size);
+  ts_parser_delete(parser);
+  unlink(generated_path);
+
+  printf("%zu files checked with 4- to %u-byte chunks, %zu differences\n", paths.size(), max_chunk_size,
+         differences);
+  return differences ? 1 : 0;
+}
@@ -0,0 +1,308 @@
+// Memory profile of parsing: how large the trees are, how much scanner state
+// the parser has to keep, and what the C++ scanner allocates.
+//
+//   mem-profile [--ext .blade.php] PATH...
+//
+// Runtime allocations are counted through `ts_set_allocator`. The scanner is
+// compiled into this program (like bench-scanner) and allocates through the
+// same hooks; global operator new/delete are replaced as well, to catch
+// anything that still bypasses them. Every allocation made while one of the
+// scanner's callbacks is running is attributed to the construct that call
+// scanned:
+//
+//   echo     echo bodies, both {{ ... }} and {!! ... !!} (one token type)
+//   script   <script>/<style> tags and their raw text
+//   custom   start and end tags of custom elements and components
+//   html     all other tags, comments and implicit end tags, and scan calls
+//            that produced no token
+//   save     serializing the scanner state after a token
+//   restore  deserializing a saved state when the parser switches versions
+//
+// Per file, the report has the tree size per source byte, the peak memory of
+// the parse, the serialized scanner state (mean and maximum size, and how many
+// states exceed the runtime's inline limit and need an allocation of their
+// own), and the scanner allocation counts for each construct.
+
+#include "common.h"
+#include "../src/scanner.cc"
+
+#include <new>
+
+using namespace tools;
+
+namespace {
+
+enum Construct {
+  ECHO_CONSTRUCT,
+  SCRIPT_CONSTRUCT,
+  CUSTOM_TAG_CONSTRUCT,
+  HTML_CONSTRUCT,
+  SAVE_CONSTRUCT,
+  RESTORE_CONSTRUCT,
+  CONSTRUCT_COUNT,
+};
+
+const char *const CONSTRUCT_NAMES[CONSTRUCT_COUNT] = {"echo", "script", "custom", "html", "save", "restore"};
+
+// Serialized states up to this size are stored inside the subtree itself
+// (see `ExternalScannerState` in the runtime); larger ones are allocated.
+const unsigned INLINE_STATE_SIZE = 24;
+
+struct HeapUsage {
+  uint64_t allocations = 0;
+  uint64_t bytes = 0;
+};
+
+struct FileProfile {
+  HeapUsage constructs[CONSTRUCT_COUNT];
+  uint64_t serializations = 0;
+  uint64_t state_bytes = 0;
+  uint64_t max_state_bytes = 0;
+  uint64_t allocated_states = 0;
+  int64_t tree_bytes = 0;
+  int64_t peak_parse_bytes = 0;
+
+  void add(const FileProfile &other) {
+    for (unsigned i = 0; i < CONSTRUCT_COUNT; i++) {
+      constructs[i].allocations += other.constructs[i].allocations;
+      constructs[i].bytes += other.constructs[i].bytes;
+    }
+    serializations += other.serializations;
+    state_bytes += other.state_bytes;
+    max_state_bytes = std::max(max_state_bytes, other.max_state_bytes);
+    allocated_states += other.allocated_states;
+    tree_bytes += other.tree_bytes;
+    peak_parse_bytes = std::max(peak_parse_bytes, other.peak_parse_bytes);
+  }
+};
+
+// Set while a scanner callback runs; only then does operator new count.
+bool in_scanner = false;
+HeapUsage global_heap;
+int64_t global_live_bytes = 0;
+
+int64_t scanner_live_bytes = 0;
+int64_t scanner_peak_live_bytes = 0;
+FileProfile profile;
+
+// The runtime does not allocate while a scanner callback runs, so whatever
+// the counting allocator sees in between belongs to the scanner.
+struct ScannerCall {
+  HeapUsage heap;
+  int64_t live_bytes;
+};
+
+HeapUsage heap_now() {
+  HeapUsage usage = global_heap;
+  usage.allocations += allocation_counters.allocations;
+  usage.bytes += allocation_counters.allocated_bytes;
+  return usage;
+}
+
+ScannerCall enter_scanner() {
+  in_scanner = true;
+  return ScannerCall{heap_now(), global_live_bytes + allocation_counters.live_bytes};
+}
+
+void leave_scanner(const ScannerCall &call, HeapUsage *construct) {
+  in_scanner = false;
+  HeapUsage heap = heap_now();
+  if (construct) {
+    construct->allocations += heap.allocations - call.heap.allocations;
+    construct->bytes += heap.bytes - call.heap.bytes;
+  }
+  scanner_live_bytes += global_live_bytes + allocation_counters.live_bytes - call.live_bytes;
+  scanner_peak_live_bytes = std::max(scanner_peak_live_bytes, scanner_live_bytes);
+}
+
+Scanner<true> *scanner_for(void *payload) {
+  return static_cast<Scanner<true> *>(payload);
+}
+
+Construct construct_for(bool result, TSSymbol symbol, bool custom_before, bool custom_after) {
+  if (!result) return HTML_CONSTRUCT;
+  switch (symbol) {
+    case RAW_ECHO_PHP:
+      return ECHO_CONSTRUCT;
+    case SCRIPT_START_TAG_NAME:
+    case STYLE_START_TAG_NAME:
+    case RAW_TEXT:
+      return SCRIPT_CONSTRUCT;
+    case START_TAG_NAME:
+      return custom_after ? CUSTOM_TAG_CONSTRUCT : HTML_CONSTRUCT;
+    case END_TAG_NAME:
+    case ERRONEOUS_END_TAG_NAME:
+      return custom_before ? CUSTOM_TAG_CONSTRUCT : HTML_CONSTRUCT;
+    default:
+      return HTML_CONSTRUCT;
+  }
+}
+
+bool top_is_custom(Scanner<true> *scanner) {
+  return !scanner->tags.empty() && scanner->tags.back().type == CUSTOM;
+}
+
+bool profiled_scan(void *payload, TSLexer *lexer, const bool *valid_symbols) {
+  bool custom_before = top_is_custom(scanner_for(payload));
+  ScannerCall call = enter_scanner();
+  bool result = scan<true>(payload, lexer, valid_symbols);
+  Construct construct = construct_for(result, lexer->result_symbol, custom_before,
+                                      top_is_custom(scanner_for(payload)));
+  leave_scanner(call, &profile.constructs[construct]);
+  return result;
+}
+
+unsigned profiled_serialize(void *payload, char *buffer) {
+  ScannerCall call = enter_scanner();
+  unsigned length = serialize<true>(payload, buffer);
+  leave_scanner(call, &profile.constructs[SAVE_CONSTRUCT]);
+  profile.serializations++;
+  profile.state_bytes += length;
+  profile.max_state_bytes = std::max<uint64_t>(profile.max_state_bytes, length);
+  if (length > INLINE_STATE_SIZE) profile.allocated_states++;
+  return length;
+}
+
+void profiled_deserialize(void *payload, const char *buffer, unsigned length) {
+  ScannerCall call = enter_scanner();
+  deserialize<true>(payload, buffer, length);
+  leave_scanner(call, &profile.constructs[RESTORE_CONSTRUCT]);
+}
+
+void *profiled_create() {
+  ScannerCall call = enter_scanner();
+  void *payload = create<true>();
+  leave_scanner(call, NULL);
+  return payload;
+}
+
+void profiled_destroy(void *payload) {
+  ScannerCall call = enter_scanner();
+  destroy<true>(payload);
+  leave_scanner(call, NULL);
+}
+
+TSLanguage profiled_language() {
+  TSLanguage language = *tree_sitter_blade();
+  language.external_scanner.create = profiled_create;
+  language.external_scanner.scan = profiled_scan;
+  language.external_scanner.serialize = profiled_serialize;
+  language.external_scanner.deserialize = profiled_deserialize;
+  language.external_scanner.destroy = profiled_destroy;
+  return language;
+}
+
+void print_header() {
+  printf("%-40s %10s %8s %8s %8s %6s %8s", "file", "bytes", "tree/B", "peak/B",
+         "state", "max", "alloc'd");
+  for (const char *name : CONSTRUCT_NAMES) printf(" %8s", name);
+  printf("\n");
+}
+
+void print_row(const string &name, const FileProfile &p, size_t bytes) {
+  double source_bytes = std::max<size_t>(bytes, 1);
+  printf("%-40s %10zu %8.2f %8.2f %8.1f %6llu %8llu", name.c_str(), bytes,
+         p.tree_bytes / source_bytes, p.peak_parse_bytes / source_bytes,
+         p.serializations ? double(p.state_bytes) / p.serializations : 0.0,
+         (unsigned long long)p.max_state_bytes, (unsigned long long)p.allocated_states);
+  for (const HeapUsage &usage : p.constructs) printf(" %8llu", (unsigned long long)usage.allocations);
+  printf("\n");
+}
+
+}
+
+// Every block carries a header with its size and whether it was counted, so
+// that blocks allocated outside the scanner can be freed inside it and vice
+// versa. GCC cannot see that `free` gets the block from `malloc` here.
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+#endif
+
+void *operator new(size_t size) {
+  size_t *block = static_cast<size_t *>(malloc(size + 2 * sizeof(size_t)));
+  if (!block) throw std::bad_alloc();
+  block[0] = size;
+  block[1] = in_scanner;
+  if (in_scanner) {
+    global_heap.allocations++;
+    global_heap.bytes += size;
+    global_live_bytes += size;
+  }
+  return block + 2;
+}
+
+void operator delete(void *pointer) noexcept {
+  if (!pointer) return;
+  size_t *block = static_cast<size_t *>(pointer) - 2;
+  if (block[1]) global_live_bytes -= block[0];
+  free(block);
+}
+
+void operator delete(void *pointer, size_t) noexcept {
+  operator delete(pointer);
+}
+
+int main(int argc, char **argv) {
+  install_counting_allocator();
+
+  string extension = ".blade.php";
+  vector<string> paths;
+  for (int i = 1; i < argc; i++) {
+    string arg = argv[i];
+    if (arg == "--ext" && i + 1 < argc) {
+      extension = argv[++i];
+    } else if (arg[0] == '-') {
+      fprintf(stderr, "usage: mem-profile [--ext EXTENSION] PATH...\n");
+      return 1;
+    } else {
+      paths.push_back(arg);
+    }
+  }
+
+  vector<SourceFile> files = load_files(paths, extension);
+  if (files.empty()) {
+    fprintf(stderr, "no input files\n");
+    return 1;
+  }
+
+  TSLanguage language = profiled_language();
+  TSParser *parser = ts_parser_new();
+  ts_parser_set_language(parser, &language);
+
+  print_header();
+  FileProfile total;
+  size_t total_bytes = 0;
+  for (const SourceFile &file : files) {
+    profile = FileProfile();
+    int64_t baseline = allocation_counters.live_bytes;
+    allocation_counters.peak_bytes = baseline;
+
+    TSTree *tree = ts_parser_parse_string(parser, NULL, file.contents.data(), file.contents.size());
+    profile.peak_parse_bytes = allocation_counters.peak_bytes - baseline;
+    int64_t live_with_tree = allocation_counters.live_bytes;
+    ts_tree_delete(tree);
+    profile.tree_bytes = live_with_tree - allocation_counters.live_bytes;
+
+    print_row(file.path, profile, file.contents.size());
+    total.add(profile);
+    total_bytes += file.contents.size();
+  }
+  if (files.size() > 1) print_row("total", total, total_bytes);
+  ts_parser_delete(parser);
+
+  double source_bytes = std::max<size_t>(total_bytes, 1);
+  printf("\nscanner heap by construct:\n");
+  for (unsigned i = 0; i < CONSTRUCT_COUNT; i++) {
+    printf("  %-8s %10llu allocations %12s %8.3f bytes per source byte\n", CONSTRUCT_NAMES[i],
+           (unsigned long long)total.constructs[i].allocations,
+           format_bytes(total.constructs[i].bytes).c_str(),
+           total.constructs[i].bytes / source_bytes);
+  }
+  printf("  peak live scanner heap: %s\n", format_bytes(scanner_peak_live_bytes).c_str());
+  printf("  through operator new:   %llu allocations, %s\n",
+         (unsigned long long)global_heap.allocations, format_bytes(global_heap.bytes).c_str());
+  printf("  external state: %llu serializations, %s total, %llu over %u bytes\n",
+         (unsigned long long)total.serializations, format_bytes(total.state_bytes).c_str(),
+         (unsigned long long)total.allocated_states, INLINE_STATE_SIZE);
+  return 0;
+}
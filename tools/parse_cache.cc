@@ -0,0 +1,448 @@
+#include "parse_cache.h"
+#include "scanner_version.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace tools {
+
+namespace {
+
+// Bump when the layout of the file, of FlatNode, Diagnostic or
+// CachedReference changes, or when ReferenceExtractor finds other references.
+const uint32_t CACHE_FORMAT_VERSION = 2;
+const char CACHE_MAGIC[8] = {'B', 'L', 'A', 'D', 'E', 'P', 'C', '\0'};
+
+// ts_builtin_sym_error, which the public API does not export.
+const TSSymbol ERROR_SYMBOL = static_cast<TSSymbol>(-1);
+
+inline uint64_t mix(uint64_t a, uint64_t b) {
+  __uint128_t product = static_cast<__uint128_t>(a) * b;
+  return static_cast<uint64_t>(product) ^ static_cast<uint64_t>(product >> 64);
+}
+
+inline uint64_t read64(const unsigned char *p) {
+  uint64_t value;
+  memcpy(&value, p, sizeof(value));
+  return value;
+}
+
+const uint64_t HASH_SECRET[3] = {0xa0761d6478bd642fULL, 0xe7037ed1a0b428dbULL, 0x8ebc6af09c88c6e3ULL};
+
+struct Fingerprint {
+  uint64_t hash = 0;
+
+  void add(const void *data, size_t length) { hash = hash_bytes(data, length, hash); }
+  void add(uint64_t value) { add(&value, sizeof(value)); }
+  void add(const char *string) { add(string ? string : "", string ? strlen(string) + 1 : 1); }
+
+  template <typename T>
+  void add_array(const T *array, size_t count) {
+    if (array) add(array, sizeof(T) * count);
+  }
+};
+
+// Whether parse table values for `symbol` are action indices (terminals) or
+// states (nonterminals).
+inline bool is_terminal(const TSLanguage *language, uint32_t symbol) {
+  return symbol < language->token_count;
+}
+
+// How many uint16_t the small parse table has. Each small state's entry is a
+// group count followed by groups of (value, symbol count, symbols...); the
+// table ends after the last of them. Also raises `*action_count` to cover
+// the actions the groups refer to.
+size_t small_parse_table_length(const TSLanguage *language, size_t *action_count) {
+  const uint16_t *table = language->small_parse_table;
+  size_t length = 0;
+  for (uint32_t state = language->large_state_count; state < language->state_count; state++) {
+    size_t i = language->small_parse_table_map[state - language->large_state_count];
+    uint16_t group_count = table[i++];
+    for (uint16_t group = 0; group < group_count; group++) {
+      uint16_t value = table[i++];
+      uint16_t symbol_count = table[i++];
+      for (uint16_t j = 0; j < symbol_count; j++) {
+        if (is_terminal(language, table[i + j])) {
+          size_t end = value + 1 + language->parse_actions[value].entry.count;
+          *action_count = std::max(*action_count, end);
+        }
+      }
+      i += symbol_count;
+    }
+    length = std::max(length, i);
+  }
+  return length;
+}
+
+// How many entries parse_actions has, judging by the ones the large states
+// refer to and `action_count` for the small ones. Each referenced entry is a
+// header followed by its actions.
+size_t parse_action_count(const TSLanguage *language, size_t action_count) {
+  for (uint32_t state = 0; state < language->large_state_count; state++) {
+    for (uint32_t symbol = 0; symbol < language->token_count; symbol++) {
+      uint16_t value = language->parse_table[state * language->symbol_count + symbol];
+      size_t end = value + 1 + language->parse_actions[value].entry.count;
+      action_count = std::max(action_count, end);
+    }
+  }
+  return action_count;
+}
+
+size_t field_map_entry_count(const TSLanguage *language) {
+  if (!language->field_count || !language->field_map_slices) return 0;
+  size_t count = 0;
+  for (uint32_t i = 0; i < language->production_id_count; i++) {
+    const TSFieldMapSlice &slice = language->field_map_slices[i];
+    count = std::max<size_t>(count, slice.index + slice.length);
+  }
+  return count;
+}
+
+}
+
+uint64_t hash_bytes(const void *data, size_t length, uint64_t seed) {
+  const unsigned char *p = static_cast<const unsigned char *>(data);
+  uint64_t h = seed ^ HASH_SECRET[0];
+  size_t remaining = length;
+  for (; remaining >= 16; remaining -= 16, p += 16) {
+    h = mix(read64(p) ^ HASH_SECRET[1], read64(p + 8) ^ h);
+  }
+  uint64_t a = 0, b = 0;
+  if (remaining >= 8) {
+    a = read64(p);
+    p += 8;
+    remaining -= 8;
+  }
+  memcpy(&b, p, remaining);
+  return mix(mix(a ^ HASH_SECRET[1], b ^ h), length ^ HASH_SECRET[2]);
+}
+
+uint64_t grammar_fingerprint(const TSLanguage *language, const string &variant) {
+  Fingerprint fingerprint;
+  fingerprint.add(CACHE_FORMAT_VERSION);
+  fingerprint.add(TREE_SITTER_BLADE_SCANNER_VERSION);
+  fingerprint.add(variant.c_str());
+  uint32_t byte_order = 0x01020304;
+  fingerprint.add(&byte_order, sizeof(byte_order));
+
+  fingerprint.add(language->version);
+  fingerprint.add(language->symbol_count);
+  fingerprint.add(language->alias_count);
+  fingerprint.add(language->token_count);
+  fingerprint.add(language->external_token_count);
+  fingerprint.add(language->state_count);
+  fingerprint.add(language->large_state_count);
+  fingerprint.add(language->production_id_count);
+  fingerprint.add(language->field_count);
+  for (uint32_t i = 0; i < language->symbol_count + language->alias_count; i++) {
+    fingerprint.add(language->symbol_names[i]);
+  }
+  for (uint32_t i = 1; i <= language->field_count; i++) {
+    fingerprint.add(language->field_names[i]);
+  }
+
+  // Precedence or conflict changes keep the symbols but move the states.
+  uint32_t small_state_count = language->state_count - language->large_state_count;
+  size_t action_count = 1;
+  size_t small_table_length = small_parse_table_length(language, &action_count);
+  fingerprint.add_array(language->parse_table, size_t(language->large_state_count) * language->symbol_count);
+  fingerprint.add_array(language->small_parse_table_map, small_state_count);
+  fingerprint.add_array(language->small_parse_table, small_table_length);
+  fingerprint.add_array(language->parse_actions, parse_action_count(language, action_count));
+  fingerprint.add_array(language->lex_modes, language->state_count);
+  fingerprint.add_array(language->symbol_metadata, language->symbol_count);
+  fingerprint.add_array(language->public_symbol_map, language->symbol_count);
+  fingerprint.add_array(language->alias_sequences,
+                        size_t(language->production_id_count) * language->max_alias_sequence_length);
+  fingerprint.add_array(language->field_map_slices, language->field_count ? language->production_id_count : 0);
+  fingerprint.add_array(language->field_map_entries, field_map_entry_count(language));
+  fingerprint.add_array(language->external_scanner.symbol_map, language->external_token_count);
+  if (language->version >= 14) fingerprint.add_array(language->primary_state_ids, language->state_count);
+  fingerprint.add(language->keyword_capture_token);
+  fingerprint.add(language->keyword_lex_fn != NULL);
+
+  // The lex functions are code, not tables. Builds that know which parser.c
+  // they compiled (tools/Makefile passes its checksum) cover them too; others
+  // only notice lexer changes that also change the tables above.
+#ifdef TREE_SITTER_BLADE_PARSER_CHECKSUM
+  fingerprint.add(TREE_SITTER_BLADE_PARSER_CHECKSUM);
+#endif
+  return fingerprint.hash;
+}
+
+void collect_diagnostics(TSNode root, vector<Diagnostic> *diagnostics) {
+  if (!ts_node_has_error(root)) return;
+
+  TSTreeCursor cursor = ts_tree_cursor_new(root);
+  for (;;) {
+    TSNode node = ts_tree_cursor_current_node(&cursor);
+    bool is_error = ts_node_symbol(node) == ERROR_SYMBOL;
+    if (is_error || ts_node_is_missing(node)) {
+      diagnostics->push_back(Diagnostic{
+        ts_node_symbol(node),
+        static_cast<uint16_t>(is_error ? ERROR_NODE : MISSING_NODE),
+        ts_node_start_point(node),
+        ts_node_end_point(node),
+      });
+    }
+
+    if (!is_error && ts_node_has_error(node) && ts_tree_cursor_goto_first_child(&cursor)) continue;
+    while (!ts_tree_cursor_goto_next_sibling(&cursor)) {
+      if (!ts_tree_cursor_goto_parent(&cursor)) {
+        ts_tree_cursor_delete(&cursor);
+        return;
+      }
+    }
+  }
+}
+
+void flatten_tree(TSNode root, ParseResult *result) {
+  result->clear();
+  collect_diagnostics(root, &result->diagnostics);
+
+  // Indices of the open ancestors of the cursor's node.
+  vector<uint32_t> parents;
+  TSTreeCursor cursor = ts_tree_cursor_new(root);
+  for (;;) {
+    TSNode node = ts_tree_cursor_current_node(&cursor);
+    uint16_t flags = 0;
+    if (ts_node_is_named(node)) flags |= NAMED_NODE;
+    if (ts_node_is_extra(node)) flags |= EXTRA_NODE;
+    if (ts_node_is_missing(node)) flags |= MISSING_NODE;
+    if (ts_node_symbol(node) == ERROR_SYMBOL) flags |= ERROR_NODE;
+    result->nodes.push_back(FlatNode{
+      ts_node_symbol(node),
+      flags,
+      parents.empty() ? UINT32_MAX : parents.back(),
+      ts_node_start_byte(node),
+      ts_node_end_byte(node),
+      ts_node_start_point(node),
+    });
+
+    if (ts_tree_cursor_goto_first_child(&cursor)) {
+      parents.push_back(result->nodes.size() - 1);
+      continue;
+    }
+    while (!ts_tree_cursor_goto_next_sibling(&cursor)) {
+      if (!ts_tree_cursor_goto_parent(&cursor)) {
+        ts_tree_cursor_delete(&cursor);
+        return;
+      }
+      parents.pop_back();
+    }
+  }
+}
+
+struct ParseCache::FileHeader {
+  char magic[8];
+  uint64_t fingerprint;
+  uint64_t entry_count;
+  uint64_t index_offset;
+};
+
+struct ParseCache::IndexEntry {
+  uint64_t hash;
+  uint32_t length;
+  uint32_t node_count;
+  uint32_t diagnostic_count;
+  uint32_t reference_count;
+  uint32_t names_length;
+  uint32_t reserved;
+  uint64_t offset;
+};
+
+ParseCache::~ParseCache() {
+  unload();
+}
+
+void ParseCache::unload() {
+  if (mapping_) munmap(mapping_, mapping_size_);
+  mapping_ = NULL;
+  mapping_size_ = 0;
+  index_ = NULL;
+  entry_count_ = 0;
+  used_.reset();
+}
+
+size_t ParseCache::load(const string &path) {
+  unload();
+  int fd = open(path.c_str(), O_RDONLY);
+  if (fd < 0) return 0;
+  struct stat info;
+  if (fstat(fd, &info) != 0 || static_cast<size_t>(info.st_size) < sizeof(FileHeader)) {
+    close(fd);
+    return 0;
+  }
+  void *mapping = mmap(NULL, info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+  close(fd);
+  if (mapping == MAP_FAILED) return 0;
+
+  size_t size = info.st_size;
+  const FileHeader *header = static_cast<const FileHeader *>(mapping);
+  bool valid = memcmp(header->magic, CACHE_MAGIC, sizeof(CACHE_MAGIC)) == 0 &&
+               header->fingerprint == fingerprint_ &&
+               header->index_offset % alignof(IndexEntry) == 0 &&
+               header->index_offset <= size &&
+               header->entry_count <= (size - header->index_offset) / sizeof(IndexEntry);
+  if (!valid) {
+    munmap(mapping, size);
+    return 0;
+  }
+
+  mapping_ = mapping;
+  mapping_size_ = size;
+  index_ = reinterpret_cast<const IndexEntry *>(static_cast<const char *>(mapping) + header->index_offset);
+  entry_count_ = header->entry_count;
+  used_.reset(new std::atomic<bool>[entry_count_]());
+  return entry_count_;
+}
+
+bool ParseCache::read_entry(const IndexEntry &entry, CachedResult *result, const char **contents) const {
+  // Entries come from disk, so check that they stay inside the data area.
+  uint64_t data_end = reinterpret_cast<const char *>(index_) - static_cast<const char *>(mapping_);
+  uint64_t node_bytes = uint64_t(entry.node_count) * sizeof(FlatNode);
+  uint64_t diagnostic_bytes = uint64_t(entry.diagnostic_count) * sizeof(Diagnostic);
+  uint64_t reference_bytes = uint64_t(entry.reference_count) * sizeof(CachedReference);
+  if (entry.offset % alignof(FlatNode) != 0 || entry.offset > data_end ||
+      node_bytes + diagnostic_bytes + reference_bytes + entry.names_length + entry.length >
+        data_end - entry.offset) {
+    return false;
+  }
+
+  const char *data = static_cast<const char *>(mapping_) + entry.offset;
+  result->nodes = reinterpret_cast<const FlatNode *>(data);
+  result->node_count = entry.node_count;
+  data += node_bytes;
+  result->diagnostics = reinterpret_cast<const Diagnostic *>(data);
+  result->diagnostic_count = entry.diagnostic_count;
+  data += diagnostic_bytes;
+  result->references = reinterpret_cast<const CachedReference *>(data);
+  result->reference_count = entry.reference_count;
+  data += reference_bytes;
+  result->reference_names = data;
+  for (uint32_t i = 0; i < entry.reference_count; i++) {
+    const CachedReference &reference = result->references[i];
+    if (reference.kind >= REFERENCE_KIND_COUNT || reference.name_offset > entry.names_length ||
+        reference.name_length > entry.names_length - reference.name_offset) {
+      return false;
+    }
+  }
+  *contents = data + entry.names_length;
+  return true;
+}
+
+bool ParseCache::find(uint64_t hash, const char *data, uint32_t length, CachedResult *result) {
+  const IndexEntry *end = index_ + entry_count_;
+  const IndexEntry *entry = std::lower_bound(index_, end, hash,
+    [](const IndexEntry &entry, uint64_t hash) { return entry.hash < hash; });
+  for (; entry != end && entry->hash == hash; entry++) {
+    const char *contents;
+    if (entry->length != length || !read_entry(*entry, result, &contents) ||
+        memcmp(contents, data, length) != 0) {
+      continue;
+    }
+    used_[entry - index_].store(true, std::memory_order_relaxed);
+    return true;
+  }
+  return false;
+}
+
+void ParseCache::add(uint64_t hash, const char *data, uint32_t length, const ParseResult &result) {
+  std::lock_guard<std::mutex> lock(added_mutex_);
+  added_.push_back(AddedEntry{hash, string(data, length), result});
+}
+
+bool ParseCache::save(const string &path) {
+  static_assert(sizeof(FlatNode) % alignof(FlatNode) == 0 && alignof(Diagnostic) <= alignof(FlatNode) &&
+                sizeof(Diagnostic) % alignof(CachedReference) == 0 &&
+                alignof(CachedReference) <= alignof(FlatNode),
+                "results are stored back to back");
+  static_assert(alignof(IndexEntry) == 8 && sizeof(FileHeader) % 8 == 0, "index alignment");
+
+  struct Entry {
+    uint64_t hash;
+    std::string_view contents;
+    const FlatNode *nodes;
+    uint32_t node_count;
+    const Diagnostic *diagnostics;
+    uint32_t diagnostic_count;
+    vector<CachedReference> references;
+    string names;
+  };
+  vector<Entry> entries;
+  for (size_t i = 0; i < entry_count_; i++) {
+    if (!used_[i].load(std::memory_order_relaxed)) continue;
+    CachedResult cached;
+    const char *contents;
+    if (!read_entry(index_[i], &cached, &contents)) continue;
+    entries.push_back(Entry{index_[i].hash, std::string_view(contents, index_[i].length), cached.nodes,
+                            cached.node_count, cached.diagnostics, cached.diagnostic_count,
+                            vector<CachedReference>(cached.references, cached.references + cached.reference_count),
+                            string(cached.reference_names, index_[i].names_length)});
+  }
+  std::lock_guard<std::mutex> lock(added_mutex_);
+  for (const AddedEntry &added : added_) {
+    entries.push_back(Entry{added.hash, added.contents, added.result.nodes.data(),
+                            static_cast<uint32_t>(added.result.nodes.size()),
+                            added.result.diagnostics.data(),
+                            static_cast<uint32_t>(added.result.diagnostics.size()), {}, {}});
+    Entry &entry = entries.back();
+    for (const Reference &reference : added.result.references) {
+      entry.references.push_back(CachedReference{reference.kind, {}, reference.start_byte,
+                                                 static_cast<uint32_t>(entry.names.size()),
+                                                 static_cast<uint32_t>(reference.name.size())});
+      entry.names += reference.name;
+    }
+  }
+  std::sort(entries.begin(), entries.end(), [](const Entry &a, const Entry &b) {
+    return a.hash != b.hash ? a.hash < b.hash : a.contents < b.contents;
+  });
+  // Identical templates parsed on different threads were added twice.
+  entries.erase(std::unique(entries.begin(), entries.end(), [](const Entry &a, const Entry &b) {
+    return a.hash == b.hash && a.contents == b.contents;
+  }), entries.end());
+
+  string temporary_path = path + ".tmp." + std::to_string(getpid());
+  FILE *file = fopen(temporary_path.c_str(), "wb");
+  if (!file) return false;
+
+  FileHeader header;
+  memcpy(header.magic, CACHE_MAGIC, sizeof(CACHE_MAGIC));
+  header.fingerprint = fingerprint_;
+  header.entry_count = entries.size();
+  header.index_offset = 0;
+  bool ok = fwrite(&header, sizeof(header), 1, file) == 1;
+
+  vector<IndexEntry> index;
+  index.reserve(entries.size());
+  uint64_t offset = sizeof(header);
+  const char padding[8] = {};
+  auto write = [&](const void *data, size_t length) {
+    ok = ok && (length == 0 || fwrite(data, 1, length, file) == length);
+    offset += length;
+  };
+  for (const Entry &entry : entries) {
+    index.push_back(IndexEntry{entry.hash, static_cast<uint32_t>(entry.contents.size()), entry.node_count,
+                               entry.diagnostic_count, static_cast<uint32_t>(entry.references.size()),
+                               static_cast<uint32_t>(entry.names.size()), 0, offset});
+    write(entry.nodes, entry.node_count * sizeof(FlatNode));
+    write(entry.diagnostics, entry.diagnostic_count * sizeof(Diagnostic));
+    write(entry.references.data(), entry.references.size() * sizeof(CachedReference));
+    write(entry.names.data(), entry.names.size());
+    write(entry.contents.data(), entry.contents.size());
+    write(padding, (8 - offset % 8) % 8);
+  }
+  header.index_offset = offset;
+  ok = ok && fwrite(index.data(), sizeof(IndexEntry), index.size(), file) == index.size() &&
+       fseek(file, 0, SEEK_SET) == 0 && fwrite(&header, sizeof(header), 1, file) == 1;
+  ok = fclose(file) == 0 && ok;
+  if (!ok || rename(temporary_path.c_str(), path.c_str()) != 0) {
+    unlink(temporary_path.c_str());
+    return false;
+  }
+  return true;
+}
+
+}
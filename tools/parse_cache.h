@@ -0,0 +1,165 @@
+#ifndef TREE_SITTER_BLADE_TOOLS_PARSE_CACHE_H_
+#define TREE_SITTER_BLADE_TOOLS_PARSE_CACHE_H_
+
+// A persistent cache of parse results, keyed by the content of the template,
+// so that unchanged templates need not be parsed again.
+//
+// The cache file is written once and then memory-mapped read-only: a header,
+// the results one after another, and an index of (content hash, length,
+// offset) sorted by hash that lookups binary-search. Each result holds the
+// flattened nodes, the diagnostics and the view references
+// (template_index.h), followed by the template itself: a lookup compares it
+// with the content it was given, so a hash collision is a miss rather than
+// another template's result. Results point straight into the mapping. The
+// header carries a fingerprint of the grammar, the scanner version
+// (src/scanner_version.h) and the file format; a file with a different
+// fingerprint is ignored as a whole. The file is in native byte order and is
+// not meant to be shared between architectures.
+
+#include "common.h"
+#include "template_index.h"
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+
+namespace tools {
+
+// A 64-bit hash of `length` bytes, fast enough to run over every template on
+// each run (a multiply-mix over 16-byte blocks, in the style of wyhash).
+uint64_t hash_bytes(const void *data, size_t length, uint64_t seed = 0);
+
+// Identifies everything that decides what the parser produces: the tables of
+// `language` (parse tables and actions, lex modes, symbols, fields and
+// aliases), the scanner variant (the name given to `language_for_name`,
+// since blade and strict share their tables), the scanner version, the cache
+// format and, when built with TREE_SITTER_BLADE_PARSER_CHECKSUM, the
+// generated lexer.
+uint64_t grammar_fingerprint(const TSLanguage *language, const string &variant);
+
+enum FlatNodeFlags : uint16_t {
+  NAMED_NODE = 1,
+  EXTRA_NODE = 2,
+  MISSING_NODE = 4,
+  ERROR_NODE = 8,
+};
+
+// One node of a tree, in pre-order. The root's parent is UINT32_MAX.
+struct FlatNode {
+  TSSymbol symbol;
+  uint16_t flags;
+  uint32_t parent;
+  uint32_t start_byte;
+  uint32_t end_byte;
+  TSPoint start_point;
+};
+
+// An ERROR node, or a MISSING node with the symbol it stands for.
+struct Diagnostic {
+  TSSymbol symbol;
+  uint16_t flags;
+  TSPoint start_point;
+  TSPoint end_point;
+};
+
+struct ParseResult {
+  vector<FlatNode> nodes;
+  vector<Diagnostic> diagnostics;
+  // Filled in by the caller, with ReferenceExtractor::extract.
+  vector<Reference> references;
+
+  void clear() {
+    nodes.clear();
+    diagnostics.clear();
+    references.clear();
+  }
+};
+
+// The ERROR and MISSING nodes under `root`. Subtrees without errors are
+// skipped, and ERROR nodes are not searched for further errors inside them.
+void collect_diagnostics(TSNode root, vector<Diagnostic> *diagnostics);
+
+// Fills `result` with every node under `root` and its diagnostics, and
+// clears its references.
+void flatten_tree(TSNode root, ParseResult *result);
+
+// A Reference as stored in the cache, with its name in the result's names.
+struct CachedReference {
+  ReferenceKind kind;
+  uint8_t reserved[3];
+  uint32_t start_byte;
+  uint32_t name_offset;
+  uint32_t name_length;
+};
+
+// A cached result; the arrays point into the mapped cache file.
+struct CachedResult {
+  const FlatNode *nodes;
+  uint32_t node_count;
+  const Diagnostic *diagnostics;
+  uint32_t diagnostic_count;
+  const CachedReference *references;
+  uint32_t reference_count;
+  const char *reference_names;
+
+  std::string_view name(const CachedReference &reference) const {
+    return std::string_view(reference_names + reference.name_offset, reference.name_length);
+  }
+};
+
+class ParseCache {
+ public:
+  explicit ParseCache(uint64_t fingerprint) : fingerprint_(fingerprint) {}
+  ~ParseCache();
+
+  ParseCache(const ParseCache &) = delete;
+  ParseCache &operator=(const ParseCache &) = delete;
+
+  // Maps the cache file at `path`, in place of any loaded before. A missing
+  // or unreadable file, or one that was written with another fingerprint,
+  // leaves the cache empty. Returns the number of entries loaded.
+  size_t load(const string &path);
+
+  // Looks up the result for the template `data`, whose `hash_bytes` is
+  // `hash`. Safe to call from several threads, also while others call `add`.
+  bool find(uint64_t hash, const char *data, uint32_t length, CachedResult *result);
+
+  // Records the result of a template that was not in the cache.
+  void add(uint64_t hash, const char *data, uint32_t length, const ParseResult &result);
+
+  // Writes every entry that was found or added since `load` to `path`, so
+  // that results for deleted or changed templates drop out. The file is
+  // replaced atomically.
+  bool save(const string &path);
+
+  size_t loaded_entries() const { return entry_count_; }
+
+ private:
+  struct FileHeader;
+  struct IndexEntry;
+
+  struct AddedEntry {
+    uint64_t hash;
+    string contents;
+    ParseResult result;
+  };
+
+  // The result stored for `entry`, and the template it is for. Returns
+  // false if the entry points outside the file.
+  bool read_entry(const IndexEntry &entry, CachedResult *result, const char **contents) const;
+  void unload();
+
+  uint64_t fingerprint_;
+  void *mapping_ = NULL;
+  size_t mapping_size_ = 0;
+  const IndexEntry *index_ = NULL;
+  size_t entry_count_ = 0;
+  std::unique_ptr<std::atomic<bool>[]> used_;
+
+  std::mutex added_mutex_;
+  vector<AddedEntry> added_;
+};
+
+}
+
+#endif  // TREE_SITTER_BLADE_TOOLS_PARSE_CACHE_H_
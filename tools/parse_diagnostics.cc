@@ -0,0 +1,221 @@
+// Reports, per template, how much GLR forking and error recovery the parse
+// needed.
+//
+//   parse-diagnostics [--lang blade|strict] [--top N] [--ext .blade.php] PATH...
+//
+// The numbers come from the tree-sitter debug log plus wrappers around the
+// external scanner:
+//
+//   versions  largest number of parse stack versions alive at once
+//   forked    parser steps taken while more than one version was alive
+//   condense  times the parser had to merge or drop versions
+//   errors    error detections (`detect_error`)
+//   recover   recovery actions: recover_to_previous, recover_eof,
+//             recover_with_missing and skip_token
+//   ext lexes calls into the external scanner
+//   restores  scanner deserializations with a state other than the one just
+//             serialized, i.e. the parser switched versions or backtracked
+//
+// With --top, the lookahead symbols and parse states seen while more than one
+// version was alive are aggregated over all files, which points at the
+// grammar rules that are ambiguous in practice.
+
+#include "common.h"
+#include <map>
+
+using namespace tools;
+
+namespace {
+
+struct Diagnostics {
+  uint64_t max_versions = 0;
+  uint64_t steps = 0;
+  uint64_t forked_steps = 0;
+  uint64_t condenses = 0;
+  uint64_t errors = 0;
+  uint64_t recoveries = 0;
+  uint64_t external_lexes = 0;
+  uint64_t restores = 0;
+
+  void add(const Diagnostics &other) {
+    max_versions = std::max(max_versions, other.max_versions);
+    steps += other.steps;
+    forked_steps += other.forked_steps;
+    condenses += other.condenses;
+    errors += other.errors;
+    recoveries += other.recoveries;
+    external_lexes += other.external_lexes;
+    restores += other.restores;
+  }
+};
+
+struct Collector {
+  Diagnostics current;
+  bool forked = false;
+  std::map<string, uint64_t> forked_lookaheads;
+  std::map<unsigned, uint64_t> forked_states;
+
+  // Scanner state as last written by serialize, to tell real restores apart
+  // from the deserialize call that precedes every external lex.
+  vector<char> serialized;
+};
+
+Collector collector;
+
+bool starts_with(const char *message, const char *prefix) {
+  return strncmp(message, prefix, strlen(prefix)) == 0;
+}
+
+void log_message(void *, TSLogType type, const char *message) {
+  Diagnostics &d = collector.current;
+  // Per-character lexer messages carry nothing we count.
+  if (type == TSLogTypeLex) return;
+
+  unsigned version, version_count, state;
+  if (starts_with(message, "lexed_lookahead sym:")) {
+    if (collector.forked) {
+      const char *symbol = message + strlen("lexed_lookahead sym:");
+      const char *end = strstr(symbol, ", size:");
+      collector.forked_lookaheads[string(symbol, end ? end - symbol : strlen(symbol))]++;
+    }
+  } else if (sscanf(message, "process version:%u, version_count:%u, state:%u",
+             &version, &version_count, &state) == 3) {
+    d.steps++;
+    d.max_versions = std::max<uint64_t>(d.max_versions, version_count);
+    collector.forked = version_count > 1;
+    if (collector.forked) {
+      d.forked_steps++;
+      collector.forked_states[state]++;
+    }
+  } else if (starts_with(message, "lex_external")) {
+    d.external_lexes++;
+  } else if (starts_with(message, "condense")) {
+    d.condenses++;
+  } else if (starts_with(message, "detect_error")) {
+    d.errors++;
+  } else if (starts_with(message, "recover_to_previous") || starts_with(message, "recover_eof") ||
+             starts_with(message, "recover_with_missing") || starts_with(message, "skip_token")) {
+    d.recoveries++;
+  }
+}
+
+TSLanguage diagnostic_language;
+unsigned (*scanner_serialize)(void *, char *);
+void (*scanner_deserialize)(void *, const char *, unsigned);
+
+unsigned tracking_serialize(void *payload, char *buffer) {
+  unsigned length = scanner_serialize(payload, buffer);
+  collector.serialized.assign(buffer, buffer + length);
+  return length;
+}
+
+void tracking_deserialize(void *payload, const char *buffer, unsigned length) {
+  if (length != collector.serialized.size() ||
+      (length && memcmp(buffer, collector.serialized.data(), length) != 0)) {
+    collector.current.restores++;
+    collector.serialized.assign(buffer, buffer + length);
+  }
+  scanner_deserialize(payload, buffer, length);
+}
+
+const TSLanguage *track_scanner_state(const TSLanguage *language) {
+  diagnostic_language = *language;
+  scanner_serialize = language->external_scanner.serialize;
+  scanner_deserialize = language->external_scanner.deserialize;
+  diagnostic_language.external_scanner.serialize = tracking_serialize;
+  diagnostic_language.external_scanner.deserialize = tracking_deserialize;
+  return &diagnostic_language;
+}
+
+void print_row(const string &name, const Diagnostics &d, size_t bytes) {
+  printf("%-40s %10zu %8llu %8.1f%% %8llu %8llu %8llu %8llu %8llu\n", name.c_str(), bytes,
+         (unsigned long long)d.max_versions,
+         d.steps ? 100.0 * d.forked_steps / d.steps : 0.0,
+         (unsigned long long)d.condenses,
+         (unsigned long long)d.errors,
+         (unsigned long long)d.recoveries,
+         (unsigned long long)d.external_lexes,
+         (unsigned long long)d.restores);
+}
+
+template <typename Key>
+void print_top(const char *title, const std::map<Key, uint64_t> &counts, size_t top,
+               string (*format)(const Key &)) {
+  vector<std::pair<uint64_t, Key>> sorted;
+  for (const auto &entry : counts) sorted.push_back({entry.second, entry.first});
+  std::sort(sorted.begin(), sorted.end(), [](const auto &a, const auto &b) { return a.first > b.first; });
+  if (sorted.size() > top) sorted.resize(top);
+
+  printf("\n%s\n", title);
+  for (const auto &entry : sorted) {
+    printf("  %10llu  %s\n", (unsigned long long)entry.first, format(entry.second).c_str());
+  }
+}
+
+string format_symbol(const string &symbol) { return symbol; }
+string format_state(const unsigned &state) { return "state " + std::to_string(state); }
+
+void usage() {
+  fprintf(stderr, "usage: parse-diagnostics [--lang blade|strict] [--top N] [--ext EXTENSION] PATH...\n");
+  exit(1);
+}
+
+}
+
+int main(int argc, char **argv) {
+  string language_name = "blade";
+  string extension = ".blade.php";
+  size_t top = 0;
+  vector<string> paths;
+
+  for (int i = 1; i < argc; i++) {
+    string arg = argv[i];
+    if (arg == "--lang" && i + 1 < argc) {
+      language_name = argv[++i];
+    } else if (arg == "--top" && i + 1 < argc) {
+      top = strtoul(argv[++i], NULL, 10);
+    } else if (arg == "--ext" && i + 1 < argc) {
+      extension = argv[++i];
+    } else if (arg[0] == '-') {
+      usage();
+    } else {
+      paths.push_back(arg);
+    }
+  }
+  if (paths.empty()) usage();
+
+  vector<SourceFile> files = load_files(paths, extension);
+  if (files.empty()) {
+    fprintf(stderr, "no input files\n");
+    return 1;
+  }
+
+  TSParser *parser = ts_parser_new();
+  ts_parser_set_language(parser, track_scanner_state(language_for_name(language_name)));
+  ts_parser_set_logger(parser, TSLogger{NULL, log_message});
+
+  printf("%-40s %10s %8s %9s %8s %8s %8s %8s %8s\n", "file", "bytes", "versions",
+         "forked", "condense", "errors", "recover", "ext lexes", "restores");
+
+  Diagnostics total;
+  size_t total_bytes = 0;
+  for (const SourceFile &file : files) {
+    collector.current = Diagnostics();
+    collector.forked = false;
+    collector.serialized.clear();
+    ts_tree_delete(ts_parser_parse_string(parser, NULL, file.contents.data(), file.contents.size()));
+    print_row(file.path, collector.current, file.contents.size());
+    total.add(collector.current);
+    total_bytes += file.contents.size();
+  }
+  if (files.size() > 1) print_row("total", total, total_bytes);
+
+  if (top) {
+    print_top("lookahead symbols while forked:", collector.forked_lookaheads, top, format_symbol);
+    print_top("parse states while forked:", collector.forked_states, top, format_state);
+  }
+
+  ts_parser_set_logger(parser, TSLogger{NULL, NULL});
+  ts_parser_delete(parser);
+  return 0;
+}
@@ -0,0 +1,282 @@
+// Runs the pathological inputs described in stress/budgets.txt and fails if
+// any of them exceeds its budget.
+//
+//   stress-test [--budgets FILE] [CASE...]
+//   stress-test --calibrate [--budgets FILE] > NEW_BUDGETS
+//
+// The budgets count work rather than time, so a run gives the same numbers
+// on any machine. Only a coarse ceiling on the time per byte backs them up,
+// so that a slowdown the counters miss (in the parser rather than the
+// scanner, say) still fails. --calibrate measures every case and prints the
+// budgets file again with each work budget set to twice the measured value,
+// recording the date of the run in the file; time ceilings are kept as they
+// are.
+
+#include "common.h"
+
+#include <cmath>
+#include <ctime>
+
+using namespace tools;
+
+namespace {
+
+// Linear parsing does about twice the work for twice the input, quadratic
+// parsing four times.
+const double DEFAULT_MAX_GROWTH = 3;
+
+// Tens of times slower than a parse in an optimized build, and still several
+// times slower under sanitizers, so only a real slowdown gets here.
+const double DEFAULT_MAX_NS_PER_BYTE = 2000;
+
+struct StressCase {
+  string name;
+  string prefix, repeat, close, suffix;
+  size_t count = 0;
+  double max_advances_per_byte = 0;
+  double max_scans_per_byte = 0;
+  double max_allocations_per_byte = 0;
+  double max_tree_bytes_per_byte = 0;
+  double max_growth = DEFAULT_MAX_GROWTH;
+  double max_ns_per_byte = DEFAULT_MAX_NS_PER_BYTE;
+
+  string input(size_t count) const {
+    string result = prefix;
+    result.reserve(prefix.size() + (repeat.size() + close.size()) * count + suffix.size());
+    for (size_t i = 0; i < count; i++) result += repeat;
+    for (size_t i = 0; i < count; i++) result += close;
+    result += suffix;
+    return result;
+  }
+};
+
+string unescape(const string &value) {
+  string result;
+  for (size_t i = 0; i < value.size(); i++) {
+    if (value[i] == '\\' && i + 1 < value.size() && value[i + 1] == 'n') {
+      result += '\n';
+      i++;
+    } else {
+      result += value[i];
+    }
+  }
+  return result;
+}
+
+string trim(const string &text) {
+  size_t start = text.find_first_not_of(" \t");
+  size_t end = text.find_last_not_of(" \t\r");
+  return start == string::npos ? string() : text.substr(start, end - start + 1);
+}
+
+// --calibrate prints the comment at the top of the budgets file again, with
+// the line that starts with this replaced.
+const char CALIBRATION_PREFIX[] = "# Calibrated ";
+
+bool load_budgets(const string &path, vector<StressCase> *cases, vector<string> *header) {
+  std::ifstream file(path);
+  if (!file) return false;
+  string line;
+  while (std::getline(file, line)) {
+    if (cases->empty() && (line.empty() || line[0] == '#') &&
+        line.compare(0, strlen(CALIBRATION_PREFIX), CALIBRATION_PREFIX) != 0) {
+      header->push_back(line);
+    }
+    line = trim(line);
+    if (line.empty() || line[0] == '#') continue;
+    if (line[0] == '[') {
+      cases->push_back(StressCase());
+      cases->back().name = line.substr(1, line.find(']') - 1);
+      continue;
+    }
+    size_t equals = line.find('=');
+    if (cases->empty() || equals == string::npos) {
+      fprintf(stderr, "%s: unexpected line '%s'\n", path.c_str(), line.c_str());
+      return false;
+    }
+
+    StressCase &stress_case = cases->back();
+    string key = trim(line.substr(0, equals));
+    string value = unescape(trim(line.substr(equals + 1)));
+    if (key == "prefix") stress_case.prefix = value;
+    else if (key == "repeat") stress_case.repeat = value;
+    else if (key == "close") stress_case.close = value;
+    else if (key == "suffix") stress_case.suffix = value;
+    else if (key == "count") stress_case.count = strtoull(value.c_str(), NULL, 10);
+    else if (key == "max_advances_per_byte") stress_case.max_advances_per_byte = atof(value.c_str());
+    else if (key == "max_scans_per_byte") stress_case.max_scans_per_byte = atof(value.c_str());
+    else if (key == "max_allocations_per_byte") stress_case.max_allocations_per_byte = atof(value.c_str());
+    else if (key == "max_growth") stress_case.max_growth = atof(value.c_str());
+    else if (key == "max_ns_per_byte") stress_case.max_ns_per_byte = atof(value.c_str());
+    else if (key == "max_tree_bytes_per_byte") stress_case.max_tree_bytes_per_byte = atof(value.c_str());
+    else {
+      fprintf(stderr, "%s: unknown key '%s'\n", path.c_str(), key.c_str());
+      return false;
+    }
+  }
+  return true;
+}
+
+bool check(const char *what, double value, double budget) {
+  if (budget > 0 && value > budget) {
+    printf("    %s: %.2f exceeds budget of %.2f\n", what, value, budget);
+    return false;
+  }
+  return true;
+}
+
+struct Measurement {
+  double advances_per_byte;
+  double scans_per_byte;
+  double allocations_per_byte;
+  double tree_bytes_per_byte;
+  // Scan calls plus advances for the input relative to the same input with
+  // half the repetitions.
+  double growth;
+  double ns_per_byte;
+};
+
+uint64_t scanner_work() {
+  return scanner_counters.scans + scanner_counters.advances;
+}
+
+Measurement measure(TSParser *parser, const StressCase &stress_case) {
+  string half_input = stress_case.input(stress_case.count / 2);
+  scanner_counters = ScannerCounters();
+  ts_tree_delete(ts_parser_parse_string(parser, NULL, half_input.data(), half_input.size()));
+  uint64_t half_work = scanner_work();
+
+  string input = stress_case.input(stress_case.count);
+  double bytes = std::max<size_t>(input.size(), 1);
+  scanner_counters = ScannerCounters();
+  uint64_t allocations = allocation_counters.allocations;
+  uint64_t start = now_ns();
+  TSTree *tree = ts_parser_parse_string(parser, NULL, input.data(), input.size());
+  uint64_t elapsed = now_ns() - start;
+  allocations = allocation_counters.allocations - allocations;
+
+  int64_t live_with_tree = allocation_counters.live_bytes;
+  ts_tree_delete(tree);
+  int64_t tree_bytes = live_with_tree - allocation_counters.live_bytes;
+
+  Measurement result;
+  result.advances_per_byte = scanner_counters.advances / bytes;
+  result.scans_per_byte = scanner_counters.scans / bytes;
+  result.allocations_per_byte = allocations / bytes;
+  result.tree_bytes_per_byte = tree_bytes / bytes;
+  result.growth = static_cast<double>(scanner_work()) / std::max<uint64_t>(half_work, 1);
+  result.ns_per_byte = elapsed / bytes;
+  return result;
+}
+
+// Twice the measured value, rounded up to two significant digits.
+double calibrated(double value) {
+  double budget = value * 2;
+  if (budget <= 0) return 0;
+  double scale = pow(10, floor(log10(budget)) - 1);
+  return ceil(budget / scale) * scale;
+}
+
+void print_calibrated(const StressCase &stress_case, const Measurement &result) {
+  printf("\n[%s]\n", stress_case.name.c_str());
+  auto field = [](const char *key, const string &value) {
+    if (value.empty()) return;
+    string escaped;
+    for (char c : value) escaped += c == '\n' ? string("\\n") : string(1, c);
+    printf("%s = %s\n", key, escaped.c_str());
+  };
+  field("prefix", stress_case.prefix);
+  field("repeat", stress_case.repeat);
+  field("close", stress_case.close);
+  field("count", std::to_string(stress_case.count));
+  field("suffix", stress_case.suffix);
+  printf("max_advances_per_byte = %g\n", calibrated(result.advances_per_byte));
+  printf("max_scans_per_byte = %g\n", calibrated(result.scans_per_byte));
+  printf("max_allocations_per_byte = %g\n", calibrated(result.allocations_per_byte));
+  printf("max_tree_bytes_per_byte = %g\n", calibrated(result.tree_bytes_per_byte));
+  if (stress_case.max_growth != DEFAULT_MAX_GROWTH) printf("max_growth = %g\n", stress_case.max_growth);
+  if (stress_case.max_ns_per_byte != DEFAULT_MAX_NS_PER_BYTE) {
+    printf("max_ns_per_byte = %g\n", stress_case.max_ns_per_byte);
+  }
+}
+
+}
+
+int main(int argc, char **argv) {
+  install_counting_allocator();
+
+  string budgets_path = "../stress/budgets.txt";
+  bool calibrate = false;
+  vector<string> selected;
+  for (int i = 1; i < argc; i++) {
+    string arg = argv[i];
+    if (arg == "--budgets" && i + 1 < argc) {
+      budgets_path = argv[++i];
+    } else if (arg == "--calibrate") {
+      calibrate = true;
+    } else if (arg[0] == '-') {
+      fprintf(stderr,
+        "usage: stress-test [--budgets FILE] [CASE...]\n"
+        "       stress-test --calibrate [--budgets FILE]\n");
+      return 1;
+    } else {
+      selected.push_back(arg);
+    }
+  }
+
+  vector<StressCase> cases;
+  vector<string> header;
+  if (!load_budgets(budgets_path, &cases, &header)) {
+    fprintf(stderr, "could not load %s\n", budgets_path.c_str());
+    return 1;
+  }
+
+  TSParser *parser = ts_parser_new();
+  ts_parser_set_language(parser, instrument_scanner());
+
+  if (calibrate) {
+    while (!header.empty() && (header.back().empty() || header.back() == "#")) header.pop_back();
+    for (const string &line : header) printf("%s\n", line.c_str());
+    time_t now = time(NULL);
+    char date[32];
+    strftime(date, sizeof(date), "%Y-%m-%d", gmtime(&now));
+    printf("#\n%sby `stress-test --calibrate` on %s: budgets are twice the measured values.\n",
+           CALIBRATION_PREFIX, date);
+    for (const StressCase &stress_case : cases) print_calibrated(stress_case, measure(parser, stress_case));
+    ts_parser_delete(parser);
+    return 0;
+  }
+
+  unsigned failures = 0, run = 0;
+  printf("%-24s %10s %14s %11s %16s %15s %7s %8s\n", "case", "bytes", "advances/byte", "scans/byte",
+         "allocations/byte", "tree bytes/byte", "growth", "ns/byte");
+  for (const StressCase &stress_case : cases) {
+    if (!selected.empty() &&
+        std::find(selected.begin(), selected.end(), stress_case.name) == selected.end()) {
+      continue;
+    }
+
+    Measurement result = measure(parser, stress_case);
+    printf("%-24s %10zu %14.2f %11.2f %16.3f %15.2f %6.2fx %8.1f\n", stress_case.name.c_str(),
+           stress_case.input(stress_case.count).size(), result.advances_per_byte, result.scans_per_byte,
+           result.allocations_per_byte, result.tree_bytes_per_byte, result.growth, result.ns_per_byte);
+
+    bool ok = check("lexer advances per byte", result.advances_per_byte, stress_case.max_advances_per_byte);
+    ok = check("scan calls per byte", result.scans_per_byte, stress_case.max_scans_per_byte) && ok;
+    ok = check("allocations per byte", result.allocations_per_byte, stress_case.max_allocations_per_byte) && ok;
+    ok = check("tree bytes per byte", result.tree_bytes_per_byte, stress_case.max_tree_bytes_per_byte) && ok;
+    ok = check("work growth for twice the input", result.growth, stress_case.max_growth) && ok;
+    ok = check("nanoseconds per byte", result.ns_per_byte, stress_case.max_ns_per_byte) && ok;
+    if (!ok) failures++;
+    run++;
+  }
+
+  ts_parser_delete(parser);
+
+  if (failures) {
+    printf("\n%u of %u cases over budget\n", failures, run);
+    return 1;
+  }
+  printf("\nall %u cases within budget\n", run);
+  return 0;
+}
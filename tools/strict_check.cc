@@ -0,0 +1,141 @@
+// Checks that tree_sitter_blade_strict builds the same trees as
+// tree_sitter_blade for well-formed input.
+//
+//   strict-check [--ext .blade.php] [PATH...]
+//
+// PATHs are templates, directories of them, or template packs. Files ending
+// in `.txt` are read as tree-sitter corpus files and their test inputs are
+// checked one by one; `--ext .txt` collects them from a directory. An input counts as well-formed when the recovering parser builds a
+// tree without ERROR or MISSING nodes; other inputs are skipped, since
+// strict mode is allowed to parse them differently. A few built-in cases
+// cover void elements, which are the one thing strict mode still closes
+// implicitly. Every difference is printed; the exit status is 1 if there
+// was one.
+//
+//   make -C tools strict-check   # the corpus in corpus/
+
+#include "common.h"
+
+using namespace tools;
+
+namespace {
+
+struct Input {
+  string name;
+  string text;
+};
+
+const Input BUILT_IN_INPUTS[] = {
+  {"void element", "<div><br><hr/><img src=\"a.png\"></div>"},
+  {"void element closed by its end tag", "<br></br>"},
+  {"void element with end tag in a parent", "<p><img src=\"a.png\"></img></p>"},
+  {"void element before a sibling end tag", "<div><input name=\"a\"></div>"},
+  {"void element in an echo", "<div><br>{{ $value }}</div>"},
+};
+
+bool is_rule_line(const string &line, char c) {
+  return line.size() >= 3 && line.find_first_not_of(c) == string::npos;
+}
+
+// Splits a corpus file into its test inputs.
+vector<Input> corpus_inputs(const string &path, const string &contents) {
+  vector<Input> inputs;
+  std::istringstream lines(contents);
+  string line, name, text;
+  enum { BEFORE, NAME, INPUT, EXPECTED } state = BEFORE;
+  auto finish = [&] {
+    if (state == INPUT || state == EXPECTED) {
+      while (!text.empty() && text.back() == '\n') text.pop_back();
+      inputs.push_back(Input{path + ": " + name, text});
+    }
+  };
+  while (std::getline(lines, line)) {
+    if (is_rule_line(line, '=')) {
+      if (state == NAME) {
+        state = INPUT;
+        text.clear();
+      } else {
+        finish();
+        state = NAME;
+        name.clear();
+      }
+    } else if (state == NAME) {
+      name = line;
+    } else if (state == INPUT) {
+      if (is_rule_line(line, '-')) {
+        state = EXPECTED;
+      } else {
+        text += line + "\n";
+      }
+    }
+  }
+  finish();
+  return inputs;
+}
+
+string tree_string(TSTree *tree) {
+  char *sexp = ts_node_string(ts_tree_root_node(tree));
+  string result = sexp;
+  free(sexp);
+  return result;
+}
+
+}
+
+int main(int argc, char **argv) {
+  string extension = ".blade.php";
+  vector<string> paths;
+  for (int i = 1; i < argc; i++) {
+    string arg = argv[i];
+    if (arg == "--ext" && i + 1 < argc) {
+      extension = argv[++i];
+    } else if (arg[0] == '-') {
+      fprintf(stderr, "usage: strict-check [--ext EXTENSION] [PATH...]\n");
+      return 1;
+    } else {
+      paths.push_back(arg);
+    }
+  }
+
+  vector<Input> inputs(std::begin(BUILT_IN_INPUTS), std::end(BUILT_IN_INPUTS));
+  for (const string &path : paths) {
+    for (SourceFile &file : load_files({path}, extension)) {
+      if (has_suffix(file.path, ".txt")) {
+        for (Input &input : corpus_inputs(file.path, file.contents)) inputs.push_back(std::move(input));
+      } else {
+        inputs.push_back(Input{file.path, std::move(file.contents)});
+      }
+    }
+  }
+
+  TSParser *recovering = ts_parser_new();
+  ts_parser_set_language(recovering, tree_sitter_blade());
+  TSParser *strict = ts_parser_new();
+  ts_parser_set_language(strict, tree_sitter_blade_strict());
+
+  size_t checked = 0, skipped = 0, differences = 0;
+  for (const Input &input : inputs) {
+    TSTree *expected = ts_parser_parse_string(recovering, NULL, input.text.data(), input.text.size());
+    if (ts_node_has_error(ts_tree_root_node(expected))) {
+      ts_tree_delete(expected);
+      skipped++;
+      continue;
+    }
+    TSTree *actual = ts_parser_parse_string(strict, NULL, input.text.data(), input.text.size());
+    string expected_string = tree_string(expected);
+    string actual_string = tree_string(actual);
+    if (expected_string != actual_string) {
+      printf("%s\n  blade:  %s\n  strict: %s\n", input.name.c_str(), expected_string.c_str(),
+             actual_string.c_str());
+      differences++;
+    }
+    ts_tree_delete(expected);
+    ts_tree_delete(actual);
+    checked++;
+  }
+
+  ts_parser_delete(recovering);
+  ts_parser_delete(strict);
+  printf("%zu inputs checked, %zu skipped as malformed, %zu differences\n", checked, skipped, differences);
+  return differences ? 1 : 0;
+}
@@ -0,0 +1,441 @@
+#include "template_index.h"
+
+namespace tools {
+
+const char *const REFERENCE_KIND_NAMES[REFERENCE_KIND_COUNT] = {
+  "extends", "include", "each", "component", "livewire", "section", "yield", "stack", "push",
+};
+
+namespace {
+
+// How far past the `@` of a directive its closing parenthesis is searched
+// for. This also bounds how far before an edit a directive can start and
+// still be affected by it (see TemplateReferences).
+const uint32_t MAX_DIRECTIVE_LENGTH = 4096;
+
+struct Directive {
+  const char *name;
+  ReferenceKind kind;
+  // Which arguments name a view, section or stack; -1 for unused slots.
+  int8_t arguments[2];
+  // Whether the first of them is an array of names (@includeFirst).
+  bool array;
+};
+
+const Directive DIRECTIVES[] = {
+  {"extends", EXTENDS_REFERENCE, {0, -1}, false},
+  {"include", INCLUDE_REFERENCE, {0, -1}, false},
+  {"includeIf", INCLUDE_REFERENCE, {0, -1}, false},
+  {"includeWhen", INCLUDE_REFERENCE, {1, -1}, false},
+  {"includeUnless", INCLUDE_REFERENCE, {1, -1}, false},
+  {"includeFirst", INCLUDE_REFERENCE, {0, -1}, true},
+  {"each", EACH_REFERENCE, {0, 3}, false},
+  {"component", COMPONENT_REFERENCE, {0, -1}, false},
+  {"livewire", LIVEWIRE_REFERENCE, {0, -1}, false},
+  {"section", SECTION_REFERENCE, {0, -1}, false},
+  {"yield", YIELD_REFERENCE, {0, -1}, false},
+  {"stack", STACK_REFERENCE, {0, -1}, false},
+  {"push", PUSH_REFERENCE, {0, -1}, false},
+  {"pushOnce", PUSH_REFERENCE, {0, -1}, false},
+  {"prepend", PUSH_REFERENCE, {0, -1}, false},
+  {"prependOnce", PUSH_REFERENCE, {0, -1}, false},
+};
+
+const Directive *find_directive(const char *name, size_t length) {
+  for (const Directive &directive : DIRECTIVES) {
+    if (strlen(directive.name) == length && memcmp(directive.name, name, length) == 0) return &directive;
+  }
+  return NULL;
+}
+
+inline bool is_word_character(char c) {
+  return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9') || c == '_';
+}
+
+struct Argument {
+  // The argument, if it is nothing but one string literal without
+  // interpolation.
+  std::string_view literal;
+  // The string literals directly inside an array argument.
+  vector<std::string_view> items;
+};
+
+// Splits the arguments of a directive, starting after its `(`, far enough to
+// find the string literals in them. Returns false if there is no closing
+// parenthesis before `end`.
+bool parse_arguments(const char *p, const char *end, vector<Argument> *arguments) {
+  arguments->clear();
+  arguments->emplace_back();
+  char openers[16];
+  unsigned depth = 0;
+  unsigned literal_count = 0;
+  bool other = false;
+  std::string_view literal;
+
+  auto finish = [&] {
+    if (literal_count == 1 && !other) arguments->back().literal = literal;
+    literal_count = 0;
+    other = false;
+  };
+
+  while (p < end) {
+    char c = *p;
+    if (c == '\'' || c == '"') {
+      const char *q = p + 1;
+      bool interpolated = false;
+      for (; q < end && *q != c; q++) {
+        if (*q == '\\') {
+          q++;
+        } else if (c == '"' && *q == '$') {
+          interpolated = true;
+        }
+      }
+      if (q >= end) return false;
+      std::string_view value(p + 1, q - p - 1);
+      if (depth == 0) {
+        literal_count++;
+        literal = value;
+        if (interpolated) other = true;
+      } else {
+        other = true;
+        if (depth == 1 && openers[0] == '[' && !interpolated) arguments->back().items.push_back(value);
+      }
+      p = q + 1;
+      continue;
+    }
+
+    if (c == '(' || c == '[' || c == '{') {
+      if (depth == sizeof(openers)) return false;
+      openers[depth++] = c;
+      other = true;
+    } else if (c == ')' || c == ']' || c == '}') {
+      if (depth == 0) {
+        if (c != ')') return false;
+        finish();
+        return true;
+      }
+      depth--;
+    } else if (c == ',' && depth == 0) {
+      finish();
+      arguments->emplace_back();
+    } else if (c != ' ' && c != '\t' && c != '\n' && c != '\r') {
+      other = true;
+    }
+    p++;
+  }
+  return false;
+}
+
+void add_reference(ReferenceKind kind, uint32_t start_byte, std::string_view name,
+                   vector<Reference> *references) {
+  if (name.empty()) return;
+  if (kind == LIVEWIRE_REFERENCE) {
+    references->push_back(Reference{kind, start_byte, "livewire." + string(name)});
+  } else {
+    references->push_back(Reference{kind, start_byte, string(name)});
+  }
+}
+
+bool has_prefix(std::string_view s, std::string_view prefix) {
+  return s.size() >= prefix.size() && s.compare(0, prefix.size(), prefix) == 0;
+}
+
+}
+
+ReferenceExtractor::ReferenceExtractor(const TSLanguage *language)
+  : text_symbol_(ts_language_symbol_for_name(language, "text", 4, true)),
+    start_tag_symbol_(ts_language_symbol_for_name(language, "start_tag", 9, true)),
+    self_closing_tag_symbol_(ts_language_symbol_for_name(language, "self_closing_tag", 16, true)),
+    tag_name_symbol_(ts_language_symbol_for_name(language, "tag_name", 8, true)) {}
+
+void ReferenceExtractor::extract(TSNode root, std::string_view source, vector<Reference> *references,
+                                 uint32_t start_byte, uint32_t end_byte) const {
+  TSTreeCursor cursor = ts_tree_cursor_new(root);
+  for (;;) {
+    TSNode node = ts_tree_cursor_current_node(&cursor);
+    uint32_t node_start = ts_node_start_byte(node);
+    uint32_t node_end = ts_node_end_byte(node);
+    bool descend = false;
+    if (node_start >= end_byte) {
+      // So are the following siblings.
+      if (!ts_tree_cursor_goto_parent(&cursor)) break;
+    } else if (node_end > start_byte) {
+      TSSymbol symbol = ts_node_symbol(node);
+      if (symbol == text_symbol_) {
+        scan_text(source, std::max(node_start, start_byte), std::min(node_end, end_byte), references);
+      } else if (symbol == start_tag_symbol_ || symbol == self_closing_tag_symbol_) {
+        if (node_start >= start_byte) add_tag(node, source, references);
+      } else {
+        descend = true;
+      }
+    }
+
+    if (descend && ts_tree_cursor_goto_first_child_for_byte(&cursor, start_byte) >= 0) continue;
+    while (!ts_tree_cursor_goto_next_sibling(&cursor)) {
+      if (!ts_tree_cursor_goto_parent(&cursor)) {
+        ts_tree_cursor_delete(&cursor);
+        return;
+      }
+    }
+  }
+  ts_tree_cursor_delete(&cursor);
+}
+
+// Finds the directives that start between `start` and `end`. Their arguments
+// may run past `end`, e.g. when an argument contains markup.
+void ReferenceExtractor::scan_text(std::string_view source, uint32_t start, uint32_t end,
+                                   vector<Reference> *references) const {
+  const char *data = source.data();
+  const char *source_end = data + source.size();
+  vector<Argument> arguments;
+  const char *p = data + start;
+  while (p < data + end) {
+    const char *at = static_cast<const char *>(memchr(p, '@', data + end - p));
+    if (!at) break;
+    p = at + 1;
+    if (at + 1 < source_end && at[1] == '@') {
+      p = at + 2;
+      continue;
+    }
+    if (at > data && (is_word_character(at[-1]) || at[-1] == '@')) continue;
+
+    const char *limit = source_end - at > ptrdiff_t(MAX_DIRECTIVE_LENGTH) ? at + MAX_DIRECTIVE_LENGTH : source_end;
+    const char *name = at + 1;
+    const char *name_end = name;
+    while (name_end < limit && is_word_character(*name_end)) name_end++;
+    const Directive *directive = find_directive(name, name_end - name);
+    p = name_end;
+    if (!directive) continue;
+
+    const char *open = name_end;
+    while (open < limit && (*open == ' ' || *open == '\t')) open++;
+    if (open == limit || *open != '(') continue;
+    if (!parse_arguments(open + 1, limit, &arguments)) continue;
+
+    uint32_t start_byte = at - data;
+    for (int8_t index : directive->arguments) {
+      if (index < 0 || size_t(index) >= arguments.size()) continue;
+      const Argument &argument = arguments[index];
+      if (directive->array) {
+        for (std::string_view item : argument.items) add_reference(directive->kind, start_byte, item, references);
+      } else {
+        add_reference(directive->kind, start_byte, argument.literal, references);
+      }
+    }
+  }
+}
+
+void ReferenceExtractor::add_tag(TSNode tag, std::string_view source, vector<Reference> *references) const {
+  uint32_t child_count = ts_node_named_child_count(tag);
+  for (uint32_t i = 0; i < child_count; i++) {
+    TSNode child = ts_node_named_child(tag, i);
+    if (ts_node_symbol(child) != tag_name_symbol_) continue;
+
+    uint32_t start = ts_node_start_byte(child);
+    std::string_view name(source.data() + start, ts_node_end_byte(child) - start);
+    uint32_t start_byte = ts_node_start_byte(tag);
+    if (has_prefix(name, "x-")) {
+      std::string_view component = name.substr(2);
+      if (component == "slot" || has_prefix(component, "slot:") || component == "dynamic-component") return;
+      if (component.find("::") != std::string_view::npos) {
+        add_reference(COMPONENT_REFERENCE, start_byte, component, references);
+      } else if (!component.empty()) {
+        references->push_back(Reference{COMPONENT_REFERENCE, start_byte, "components." + string(component)});
+      }
+    } else if (has_prefix(name, "livewire:")) {
+      add_reference(LIVEWIRE_REFERENCE, start_byte, name.substr(9), references);
+    }
+    return;
+  }
+}
+
+void TemplateReferences::reset(const TSTree *tree, const string &source) {
+  references_.clear();
+  edited_.clear();
+  extractor_->extract(ts_tree_root_node(tree), source, &references_);
+}
+
+void TemplateReferences::edit(const TSInputEdit &edit) {
+  int64_t delta = int64_t(edit.new_end_byte) - int64_t(edit.old_end_byte);
+  auto shift = [&](uint32_t byte, uint32_t inside) -> uint32_t {
+    if (byte < edit.start_byte) return byte;
+    if (byte >= edit.old_end_byte) return byte + delta;
+    return inside;
+  };
+
+  size_t kept = 0;
+  for (Reference &reference : references_) {
+    if (reference.start_byte >= edit.start_byte && reference.start_byte < edit.old_end_byte) continue;
+    reference.start_byte = shift(reference.start_byte, 0);
+    if (&references_[kept] != &reference) references_[kept] = std::move(reference);
+    kept++;
+  }
+  references_.resize(kept);
+
+  for (ByteRange &range : edited_) {
+    range.first = shift(range.first, edit.start_byte);
+    range.second = std::max(range.first, shift(range.second, edit.new_end_byte));
+  }
+  edited_.push_back(ByteRange(edit.start_byte, edit.new_end_byte));
+}
+
+uint32_t TemplateReferences::update(const TSTree *old_tree, const TSTree *new_tree, const string &source) {
+  uint32_t source_size = source.size();
+  ranges_.assign(edited_.begin(), edited_.end());
+  edited_.clear();
+  uint32_t changed_count;
+  TSRange *changed = ts_tree_get_changed_ranges(old_tree, new_tree, &changed_count);
+  for (uint32_t i = 0; i < changed_count; i++) {
+    ranges_.push_back(ByteRange(changed[i].start_byte, changed[i].end_byte));
+  }
+  free(changed);
+
+  // A directive can be affected by a change up to MAX_DIRECTIVE_LENGTH bytes
+  // after its `@`, and by the two bytes before it (`x@`, `@@`).
+  for (ByteRange &range : ranges_) {
+    range.first = range.first > MAX_DIRECTIVE_LENGTH ? range.first - MAX_DIRECTIVE_LENGTH : 0;
+    range.second = std::min(source_size, range.second + 2);
+  }
+  std::sort(ranges_.begin(), ranges_.end());
+  size_t merged = 0;
+  for (const ByteRange &range : ranges_) {
+    if (merged > 0 && range.first <= ranges_[merged - 1].second) {
+      ranges_[merged - 1].second = std::max(ranges_[merged - 1].second, range.second);
+    } else {
+      ranges_[merged++] = range;
+    }
+  }
+  ranges_.resize(merged);
+
+  // Keep the references outside the ranges and extract the ones inside them
+  // again; both are in source order, so the result is too.
+  updated_.clear();
+  TSNode root = ts_tree_root_node(new_tree);
+  uint32_t scanned = 0;
+  auto next = references_.begin();
+  for (const ByteRange &range : ranges_) {
+    for (; next != references_.end() && next->start_byte < range.first; ++next) updated_.push_back(std::move(*next));
+    while (next != references_.end() && next->start_byte < range.second) ++next;
+    extractor_->extract(root, source, &updated_, range.first, range.second);
+    scanned += range.second - range.first;
+  }
+  for (; next != references_.end(); ++next) updated_.push_back(std::move(*next));
+  references_.swap(updated_);
+  return scanned;
+}
+
+string view_name_for_path(const string &path, const string &root, const string &extension) {
+  string name = path;
+  if (!root.empty() && has_prefix(name, root)) {
+    name.erase(0, root.size());
+    while (!name.empty() && name[0] == '/') name.erase(0, 1);
+  }
+  if (has_suffix(name, extension)) name.resize(name.size() - extension.size());
+  std::replace(name.begin(), name.end(), '/', '.');
+  return name;
+}
+
+uint32_t TemplateIndex::find_name(std::string_view string) const {
+  auto found = std::lower_bound(names_by_string_.begin(), names_by_string_.end(), string,
+    [this](uint32_t id, std::string_view string) { return name(id) < string; });
+  if (found == names_by_string_.end() || name(*found) != string) return NONE;
+  return *found;
+}
+
+vector<uint32_t> TemplateIndex::dependents(uint32_t name) const {
+  vector<uint32_t> result;
+  vector<bool> seen(template_count());
+  uint32_t self = template_for_name(name);
+  if (self != NONE) seen[self] = true;
+  vector<uint32_t> pending = {name};
+  while (!pending.empty()) {
+    uint32_t current = pending.back();
+    pending.pop_back();
+    for (const Referrer &referrer : referrers(current)) {
+      if (!names_view(referrer.kind) || seen[referrer.template_id]) continue;
+      seen[referrer.template_id] = true;
+      result.push_back(referrer.template_id);
+      pending.push_back(template_names_[referrer.template_id]);
+    }
+  }
+  std::sort(result.begin(), result.end());
+  return result;
+}
+
+size_t TemplateIndex::memory_bytes() const {
+  return name_data_.capacity() +
+         sizeof(uint32_t) * (name_offsets_.capacity() + names_by_string_.capacity() +
+                             template_names_.capacity() + templates_by_name_.capacity() +
+                             edge_offsets_.capacity() + referrer_offsets_.capacity()) +
+         sizeof(Edge) * edges_.capacity() + sizeof(Referrer) * referrers_.capacity();
+}
+
+uint32_t TemplateIndexBuilder::intern(const string &name) {
+  auto inserted = name_ids_.emplace(name, names_.size());
+  if (inserted.second) names_.push_back(name);
+  return inserted.first->second;
+}
+
+uint32_t TemplateIndexBuilder::add_template(const string &view_name, const vector<Reference> &references) {
+  uint32_t template_id = template_names_.size();
+  template_names_.push_back(intern(view_name));
+
+  size_t first = edges_.size();
+  for (const Reference &reference : references) {
+    edges_.push_back(TemplateIndex::Edge{intern(reference.name), reference.kind});
+  }
+  auto begin = edges_.begin() + first;
+  std::sort(begin, edges_.end(), [](const TemplateIndex::Edge &a, const TemplateIndex::Edge &b) {
+    return a.kind != b.kind ? a.kind < b.kind : a.name < b.name;
+  });
+  edges_.erase(std::unique(begin, edges_.end(), [](const TemplateIndex::Edge &a, const TemplateIndex::Edge &b) {
+    return a.kind == b.kind && a.name == b.name;
+  }), edges_.end());
+  edge_offsets_.push_back(edges_.size());
+  return template_id;
+}
+
+TemplateIndex TemplateIndexBuilder::build() {
+  TemplateIndex index;
+  size_t name_count = names_.size();
+
+  size_t data_size = 0;
+  for (const string &name : names_) data_size += name.size();
+  index.name_data_.reserve(data_size);
+  index.name_offsets_.reserve(name_count + 1);
+  for (const string &name : names_) {
+    index.name_offsets_.push_back(index.name_data_.size());
+    index.name_data_ += name;
+  }
+  index.name_offsets_.push_back(index.name_data_.size());
+
+  index.names_by_string_.resize(name_count);
+  for (uint32_t i = 0; i < name_count; i++) index.names_by_string_[i] = i;
+  std::sort(index.names_by_string_.begin(), index.names_by_string_.end(),
+            [this](uint32_t a, uint32_t b) { return names_[a] < names_[b]; });
+
+  index.templates_by_name_.assign(name_count, TemplateIndex::NONE);
+  for (uint32_t i = template_names_.size(); i-- > 0;) index.templates_by_name_[template_names_[i]] = i;
+
+  // The reverse rows, by counting sort on the name. Filling them in template
+  // order keeps each row sorted by template.
+  index.referrer_offsets_.assign(name_count + 1, 0);
+  for (const TemplateIndex::Edge &edge : edges_) index.referrer_offsets_[edge.name + 1]++;
+  for (size_t i = 0; i < name_count; i++) index.referrer_offsets_[i + 1] += index.referrer_offsets_[i];
+  index.referrers_.resize(edges_.size());
+  vector<uint32_t> next(index.referrer_offsets_.begin(), index.referrer_offsets_.end() - 1);
+  for (uint32_t template_id = 0; template_id < template_names_.size(); template_id++) {
+    for (uint32_t i = edge_offsets_[template_id]; i < edge_offsets_[template_id + 1]; i++) {
+      const TemplateIndex::Edge &edge = edges_[i];
+      index.referrers_[next[edge.name]++] = TemplateIndex::Referrer{template_id, edge.kind};
+    }
+  }
+
+  index.template_names_ = std::move(template_names_);
+  index.edge_offsets_ = std::move(edge_offsets_);
+  index.edges_ = std::move(edges_);
+  *this = TemplateIndexBuilder();
+  return index;
+}
+
+}
@@ -0,0 +1,233 @@
+#ifndef TREE_SITTER_BLADE_TOOLS_TEMPLATE_INDEX_H_
+#define TREE_SITTER_BLADE_TOOLS_TEMPLATE_INDEX_H_
+
+// Which views reference which: an extractor that finds the references in one
+// parsed template, and a compact index over a whole project with lookups in
+// both directions.
+//
+// The grammar parses Blade directives as plain text, so they are found by
+// scanning the `text` nodes for `@name(...)` (skipping `@@` escapes and `@`s
+// that follow a word character, as Blade does) and reading the string
+// literals among the arguments; directives whose view name is not a literal
+// are skipped. Components come from tag names:
+//
+//   @extends('a')                              extends   a
+//   @include('a'), @includeIf('a')             include   a
+//   @includeWhen($c, 'a'), @includeUnless(...) include   a
+//   @includeFirst(['a', 'b'])                  include   a, b
+//   @each('a', $items, 'item', 'b')            each      a, b
+//   @component('a')                            component a
+//   <x-alert>, <x-forms.input>                 component components.alert, ...
+//   <x-mail::message>                          component mail::message
+//   @livewire('counter'), <livewire:counter>   livewire  livewire.counter
+//   @section('a'), @yield('a')                 section, yield
+//   @stack('a'), @push('a'), @prepend('a')     stack, push
+//
+// <x-slot> and <x-dynamic-component> are not references. Section, yield,
+// stack and push names share the name table with view names but are kept
+// apart by their kind.
+
+#include "common.h"
+
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+
+namespace tools {
+
+enum ReferenceKind : uint8_t {
+  EXTENDS_REFERENCE,
+  INCLUDE_REFERENCE,
+  EACH_REFERENCE,
+  COMPONENT_REFERENCE,
+  LIVEWIRE_REFERENCE,
+  SECTION_REFERENCE,
+  YIELD_REFERENCE,
+  STACK_REFERENCE,
+  PUSH_REFERENCE,
+  REFERENCE_KIND_COUNT,
+};
+
+extern const char *const REFERENCE_KIND_NAMES[REFERENCE_KIND_COUNT];
+
+// Whether references of this kind name another view (rather than a section
+// or stack).
+inline bool names_view(ReferenceKind kind) {
+  return kind <= LIVEWIRE_REFERENCE;
+}
+
+// A reference as it appears in one template. `start_byte` is where the
+// directive or tag starts.
+struct Reference {
+  ReferenceKind kind;
+  uint32_t start_byte;
+  string name;
+};
+
+class ReferenceExtractor {
+ public:
+  explicit ReferenceExtractor(const TSLanguage *language);
+
+  // Appends the references in the part of `source` between `start_byte` and
+  // `end_byte` to `references`, in source order. Only nodes overlapping that
+  // range are visited.
+  void extract(TSNode root, std::string_view source, vector<Reference> *references,
+               uint32_t start_byte = 0, uint32_t end_byte = UINT32_MAX) const;
+
+ private:
+  void scan_text(std::string_view source, uint32_t start, uint32_t end, vector<Reference> *references) const;
+  void add_tag(TSNode tag, std::string_view source, vector<Reference> *references) const;
+
+  TSSymbol text_symbol_;
+  TSSymbol start_tag_symbol_;
+  TSSymbol self_closing_tag_symbol_;
+  TSSymbol tag_name_symbol_;
+};
+
+// The references of one open template, kept up to date as it is edited and
+// reparsed incrementally, without extracting them from the whole tree again:
+//
+//   ts_tree_edit(tree, &edit);
+//   references.edit(edit);
+//   TSTree *new_tree = ts_parser_parse_string(parser, tree, ...);
+//   references.update(tree, new_tree, new_source);
+//
+// update() extracts again only around the ranges that ts_tree_get_changed_ranges
+// reports and the ranges that were edited, widened by how far a directive
+// can reach, and keeps the other references (shifted by edit()).
+class TemplateReferences {
+ public:
+  explicit TemplateReferences(const ReferenceExtractor *extractor) : extractor_(extractor) {}
+
+  // Extracts the references from the whole tree.
+  void reset(const TSTree *tree, const string &source);
+
+  // Shifts the references after an edit; call it along with ts_tree_edit.
+  void edit(const TSInputEdit &edit);
+
+  // Brings the references up to date with `new_tree`, which `old_tree` (as
+  // edited) was the old tree for. Returns how many bytes were looked at again.
+  uint32_t update(const TSTree *old_tree, const TSTree *new_tree, const string &source);
+
+  // In source order.
+  const vector<Reference> &references() const { return references_; }
+
+ private:
+  using ByteRange = std::pair<uint32_t, uint32_t>;
+
+  const ReferenceExtractor *extractor_;
+  vector<Reference> references_;
+  vector<Reference> updated_;
+  // The ranges edited since the last update, in the current coordinates.
+  vector<ByteRange> edited_;
+  vector<ByteRange> ranges_;
+};
+
+// The view name of a template file: its path below `root`, without the
+// extension and with `/` replaced by `.` (`layouts/app.blade.php` becomes
+// `layouts.app`).
+string view_name_for_path(const string &path, const string &root, const string &extension);
+
+// A pointer range into one of the index's arrays.
+template <typename T>
+struct Range {
+  const T *first;
+  const T *last;
+
+  const T *begin() const { return first; }
+  const T *end() const { return last; }
+  size_t size() const { return last - first; }
+  bool empty() const { return first == last; }
+};
+
+// An immutable index over all templates of a project. Names (of views,
+// sections and stacks) are interned and sorted once; the edges of each
+// template and the referrers of each name are stored as compressed sparse
+// rows, so both directions are a pair of offsets into one array.
+class TemplateIndex {
+ public:
+  static constexpr uint32_t NONE = UINT32_MAX;
+
+  struct Edge {
+    uint32_t name;
+    ReferenceKind kind;
+  };
+
+  struct Referrer {
+    uint32_t template_id;
+    ReferenceKind kind;
+  };
+
+  size_t template_count() const { return template_names_.size(); }
+  size_t name_count() const { return name_offsets_.size() - 1; }
+  size_t edge_count() const { return edges_.size(); }
+
+  std::string_view name(uint32_t name) const {
+    return std::string_view(name_data_.data() + name_offsets_[name],
+                            name_offsets_[name + 1] - name_offsets_[name]);
+  }
+
+  // The name id of a string, or NONE.
+  uint32_t find_name(std::string_view name) const;
+
+  uint32_t template_name(uint32_t template_id) const { return template_names_[template_id]; }
+
+  // The template with the given view name, or NONE for names that no indexed
+  // template defines (package views, sections, typos).
+  uint32_t template_for_name(uint32_t name) const { return templates_by_name_[name]; }
+
+  // Each distinct (name, kind) a template references, sorted by kind.
+  Range<Edge> references(uint32_t template_id) const {
+    return Range<Edge>{edges_.data() + edge_offsets_[template_id],
+                       edges_.data() + edge_offsets_[template_id + 1]};
+  }
+
+  // The templates that reference `name`, sorted by template.
+  Range<Referrer> referrers(uint32_t name) const {
+    return Range<Referrer>{referrers_.data() + referrer_offsets_[name],
+                           referrers_.data() + referrer_offsets_[name + 1]};
+  }
+
+  // Every template that depends on the view `name` through a chain of view
+  // references (extends, include, each, component, livewire), sorted and
+  // without the view itself: what has to be looked at again when it changes.
+  vector<uint32_t> dependents(uint32_t name) const;
+
+  size_t memory_bytes() const;
+
+ private:
+  friend class TemplateIndexBuilder;
+
+  string name_data_;
+  vector<uint32_t> name_offsets_;
+  vector<uint32_t> names_by_string_;
+  vector<uint32_t> template_names_;
+  vector<uint32_t> templates_by_name_;
+  vector<uint32_t> edge_offsets_;
+  vector<Edge> edges_;
+  vector<uint32_t> referrer_offsets_;
+  vector<Referrer> referrers_;
+};
+
+class TemplateIndexBuilder {
+ public:
+  // Adds a template and its references; templates are numbered in the order
+  // they are added.
+  uint32_t add_template(const string &view_name, const vector<Reference> &references);
+
+  // Moves everything added so far into an index.
+  TemplateIndex build();
+
+ private:
+  uint32_t intern(const string &name);
+
+  std::unordered_map<string, uint32_t> name_ids_;
+  vector<string> names_;
+  vector<uint32_t> template_names_;
+  vector<uint32_t> edge_offsets_ = {0};
+  vector<TemplateIndex::Edge> edges_;
+};
+
+}
+
+#endif  // TREE_SITTER_BLADE_TOOLS_TEMPLATE_INDEX_H_
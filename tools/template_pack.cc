@@ -0,0 +1,73 @@
+#include "template_pack.h"
+#include "common.h"
+
+namespace tools {
+
+bool write_template_pack(const string &path, vector<PackSource> sources, string *error) {
+  std::sort(sources.begin(), sources.end(), [](const PackSource &a, const PackSource &b) {
+    return a.path < b.path;
+  });
+  for (size_t i = 1; i < sources.size(); i++) {
+    if (sources[i].path == sources[i - 1].path) {
+      *error = "two templates would be stored as " + sources[i].path;
+      return false;
+    }
+  }
+
+  string temporary_path = path + ".tmp." + std::to_string(getpid());
+  FILE *file = fopen(temporary_path.c_str(), "wb");
+  if (!file) {
+    *error = "could not write " + temporary_path;
+    return false;
+  }
+
+  PackHeader header = {};
+  bool ok = fwrite(&header, sizeof(header), 1, file) == 1;
+
+  vector<PackIndexEntry> index;
+  index.reserve(sources.size());
+  uint64_t offset = sizeof(header);
+  string contents;
+  for (const PackSource &source : sources) {
+    if (!read_file(source.file, &contents) || contents.size() >= UINT32_MAX) {
+      *error = "could not read " + source.file;
+      fclose(file);
+      unlink(temporary_path.c_str());
+      return false;
+    }
+    index.push_back(PackIndexEntry{offset, static_cast<uint32_t>(contents.size()), 0, 0, 0});
+    ok = ok && fwrite(contents.data(), 1, contents.size(), file) == contents.size();
+    offset += contents.size();
+  }
+
+  header.paths_offset = offset;
+  uint64_t path_offset = 0;
+  for (size_t i = 0; i < sources.size(); i++) {
+    const string &source_path = sources[i].path;
+    index[i].path_offset = path_offset;
+    index[i].path_length = source_path.size();
+    ok = ok && fwrite(source_path.data(), 1, source_path.size(), file) == source_path.size();
+    path_offset += source_path.size();
+  }
+  if (path_offset >= UINT32_MAX) ok = false;
+
+  const char padding[8] = {};
+  size_t padding_bytes = (alignof(PackIndexEntry) - (offset + path_offset) % alignof(PackIndexEntry)) %
+                         alignof(PackIndexEntry);
+  ok = ok && fwrite(padding, 1, padding_bytes, file) == padding_bytes;
+  header.index_offset = offset + path_offset + padding_bytes;
+  ok = ok && fwrite(index.data(), sizeof(PackIndexEntry), index.size(), file) == index.size();
+
+  memcpy(header.magic, TEMPLATE_PACK_MAGIC, sizeof(TEMPLATE_PACK_MAGIC));
+  header.entry_count = index.size();
+  ok = ok && fseek(file, 0, SEEK_SET) == 0 && fwrite(&header, sizeof(header), 1, file) == 1;
+  ok = fclose(file) == 0 && ok;
+  if (!ok || rename(temporary_path.c_str(), path.c_str()) != 0) {
+    *error = "could not write " + path;
+    unlink(temporary_path.c_str());
+    return false;
+  }
+  return true;
+}
+
+}
@@ -0,0 +1,167 @@
+#ifndef TREE_SITTER_BLADE_TOOLS_TEMPLATE_PACK_H_
+#define TREE_SITTER_BLADE_TOOLS_TEMPLATE_PACK_H_
+
+// A template pack: many templates concatenated into one file, with an index
+// of their paths, so that a batch run maps one file and reads it front to
+// back instead of opening tens of thousands of small ones.
+//
+// Layout, in native byte order (like the parse cache, not meant to be shared
+// between architectures):
+//
+//   header   magic, entry count, offsets of the path data and the index
+//   contents every template, back to back, in path order
+//   paths    every path, back to back
+//   index    one PackIndexEntry per template, sorted by path
+//
+// Paths are stored relative to the directory they were collected from (see
+// `blade-pack`). The reader maps the file and hands out pointers into it;
+// nothing is copied. Packs are recognized by their extension wherever the
+// tools take a PATH (load_files in common.h, blade-parse).
+//
+// This header only needs the standard library, so that common.h can include
+// it; the writer is in template_pack.cc.
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace tools {
+
+const char TEMPLATE_PACK_EXTENSION[] = ".bladepack";
+const char TEMPLATE_PACK_MAGIC[8] = {'B', 'L', 'D', 'P', 'A', 'C', 'K', '1'};
+
+struct PackHeader {
+  char magic[8];
+  uint64_t entry_count;
+  uint64_t paths_offset;
+  uint64_t index_offset;
+};
+
+struct PackIndexEntry {
+  uint64_t offset;
+  uint32_t length;
+  uint32_t path_offset;
+  uint32_t path_length;
+  uint32_t reserved;
+};
+
+class TemplatePack {
+ public:
+  struct Entry {
+    std::string_view path;
+    const char *data;
+    uint32_t length;
+  };
+
+  TemplatePack() = default;
+  ~TemplatePack() { close(); }
+
+  TemplatePack(const TemplatePack &) = delete;
+  TemplatePack &operator=(const TemplatePack &) = delete;
+
+  // Maps the pack at `path` and checks its index. Returns false if the file
+  // cannot be read or is not a valid pack.
+  bool open(const std::string &path) {
+    close();
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) return false;
+    struct stat info;
+    if (fstat(fd, &info) != 0 || static_cast<size_t>(info.st_size) < sizeof(PackHeader)) {
+      ::close(fd);
+      return false;
+    }
+    void *mapping = mmap(NULL, info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);
+    if (mapping == MAP_FAILED) return false;
+    mapping_ = static_cast<const char *>(mapping);
+    mapping_size_ = info.st_size;
+    if (!validate()) {
+      close();
+      return false;
+    }
+    // Batch runs go through the contents in order.
+    madvise(mapping, mapping_size_, MADV_SEQUENTIAL);
+    return true;
+  }
+
+  void close() {
+    if (mapping_) munmap(const_cast<char *>(mapping_), mapping_size_);
+    mapping_ = NULL;
+    mapping_size_ = 0;
+    index_ = NULL;
+    entry_count_ = 0;
+  }
+
+  size_t size() const { return entry_count_; }
+  size_t file_size() const { return mapping_size_; }
+
+  Entry entry(size_t i) const {
+    const PackIndexEntry &entry = index_[i];
+    return Entry{std::string_view(paths_ + entry.path_offset, entry.path_length),
+                 mapping_ + entry.offset, entry.length};
+  }
+
+  // The index of the template with the given path, or size() if there is none.
+  size_t find(std::string_view path) const {
+    size_t low = 0, high = entry_count_;
+    while (low < high) {
+      size_t middle = low + (high - low) / 2;
+      if (entry(middle).path < path) {
+        low = middle + 1;
+      } else {
+        high = middle;
+      }
+    }
+    return low < entry_count_ && entry(low).path == path ? low : entry_count_;
+  }
+
+ private:
+  bool validate() {
+    const PackHeader *header = reinterpret_cast<const PackHeader *>(mapping_);
+    if (memcmp(header->magic, TEMPLATE_PACK_MAGIC, sizeof(TEMPLATE_PACK_MAGIC)) != 0 ||
+        header->paths_offset > header->index_offset || header->index_offset > mapping_size_ ||
+        header->index_offset % alignof(PackIndexEntry) != 0 ||
+        header->entry_count > (mapping_size_ - header->index_offset) / sizeof(PackIndexEntry)) {
+      return false;
+    }
+    paths_ = mapping_ + header->paths_offset;
+    index_ = reinterpret_cast<const PackIndexEntry *>(mapping_ + header->index_offset);
+    entry_count_ = header->entry_count;
+    uint64_t paths_size = header->index_offset - header->paths_offset;
+    for (size_t i = 0; i < entry_count_; i++) {
+      const PackIndexEntry &entry = index_[i];
+      if (entry.offset > header->paths_offset || entry.length > header->paths_offset - entry.offset ||
+          entry.path_offset > paths_size || entry.path_length > paths_size - entry.path_offset) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  const char *mapping_ = NULL;
+  size_t mapping_size_ = 0;
+  const char *paths_ = NULL;
+  const PackIndexEntry *index_ = NULL;
+  size_t entry_count_ = 0;
+};
+
+struct PackSource {
+  // The path to store, and the file to read the contents from.
+  std::string path;
+  std::string file;
+};
+
+// Writes the given templates into a pack at `path`, replacing it atomically.
+// Sources are sorted by path first. Returns false, with a message in
+// `error`, if a source cannot be read or the pack cannot be written.
+bool write_template_pack(const std::string &path, std::vector<PackSource> sources, std::string *error);
+
+}
+
+#endif  // TREE_SITTER_BLADE_TOOLS_TEMPLATE_PACK_H_
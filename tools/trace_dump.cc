@@ -0,0 +1,147 @@
+// Prints scan traces recorded by a scanner built with TREE_SITTER_BLADE_TRACE.
+//
+//   trace-dump [--slowest N] TRACE_FILE
+//   trace-dump [--slowest N] --parse PATH...
+//
+// The first form reads a file written by
+// `tree_sitter_blade_scanner_trace_write`. The second parses each file and
+// prints the scan calls it made, which requires the tools to be built with
+// `make TRACE=1`. With --slowest, only the N most expensive calls are shown.
+
+#include "common.h"
+#include "scanner_trace.h"
+
+using namespace tools;
+
+namespace {
+
+const size_t MAX_ENTRIES = 1 << 20;
+
+const char *const PATH_NAMES[] = {
+  "no_token",
+  "raw_text",
+  "raw_php",
+  "comment",
+  "implicit_end_tag",
+  "self_closing_tag_delimiter",
+  "start_tag_name",
+  "end_tag_name",
+};
+
+const char *const TOKEN_NAMES[] = {
+  "START_TAG_NAME",
+  "SCRIPT_START_TAG_NAME",
+  "STYLE_START_TAG_NAME",
+  "END_TAG_NAME",
+  "ERRONEOUS_END_TAG_NAME",
+  "SELF_CLOSING_TAG_DELIMITER",
+  "IMPLICIT_END_TAG",
+  "RAW_TEXT",
+  "COMMENT",
+  "RAW_ECHO_PHP",
+};
+
+const size_t TOKEN_COUNT = sizeof(TOKEN_NAMES) / sizeof(TOKEN_NAMES[0]);
+const size_t PATH_COUNT = sizeof(PATH_NAMES) / sizeof(PATH_NAMES[0]);
+
+string valid_symbol_names(uint16_t mask) {
+  string result;
+  for (size_t i = 0; i < TOKEN_COUNT; i++) {
+    if (mask & (1 << i)) {
+      if (!result.empty()) result += ',';
+      result += TOKEN_NAMES[i];
+    }
+  }
+  return result;
+}
+
+void print_entries(vector<TSBladeTraceEntry> entries, size_t slowest) {
+  vector<size_t> order(entries.size());
+  for (size_t i = 0; i < order.size(); i++) order[i] = i;
+  if (slowest) {
+    std::stable_sort(order.begin(), order.end(), [&](size_t a, size_t b) {
+      return entries[a].ticks > entries[b].ticks;
+    });
+    if (order.size() > slowest) order.resize(slowest);
+  }
+
+  printf("%8s %8s %12s  %-26s %-26s %s\n", "call", "bytes", "ticks", "path", "result", "valid");
+  for (size_t i : order) {
+    const TSBladeTraceEntry &entry = entries[i];
+    printf("%8zu %8u %12llu  %-26s %-26s %s\n", i, entry.bytes,
+           (unsigned long long)entry.ticks,
+           entry.path < PATH_COUNT ? PATH_NAMES[entry.path] : "?",
+           entry.result < TOKEN_COUNT ? TOKEN_NAMES[entry.result] : "-",
+           valid_symbol_names(entry.valid_symbols).c_str());
+  }
+}
+
+bool read_trace(const string &path, vector<TSBladeTraceEntry> *entries) {
+  FILE *file = fopen(path.c_str(), "rb");
+  if (!file) return false;
+  uint32_t magic = 0, length = 0;
+  bool ok = fread(&magic, sizeof(magic), 1, file) == 1 && magic == TS_BLADE_TRACE_FILE_MAGIC &&
+            fread(&length, sizeof(length), 1, file) == 1 && length <= MAX_ENTRIES;
+  if (ok) {
+    entries->resize(length);
+    ok = fread(entries->data(), sizeof(TSBladeTraceEntry), length, file) == length;
+  }
+  fclose(file);
+  return ok;
+}
+
+void usage() {
+  fprintf(stderr,
+    "usage: trace-dump [--slowest N] TRACE_FILE\n"
+    "       trace-dump [--slowest N] --parse PATH...\n");
+  exit(1);
+}
+
+}
+
+int main(int argc, char **argv) {
+  size_t slowest = 0;
+  bool parse = false;
+  vector<string> paths;
+  for (int i = 1; i < argc; i++) {
+    string arg = argv[i];
+    if (arg == "--slowest" && i + 1 < argc) {
+      slowest = strtoul(argv[++i], NULL, 10);
+    } else if (arg == "--parse") {
+      parse = true;
+    } else if (arg[0] == '-') {
+      usage();
+    } else {
+      paths.push_back(arg);
+    }
+  }
+  if (paths.empty() || (!parse && paths.size() != 1)) usage();
+
+  if (!parse) {
+    vector<TSBladeTraceEntry> entries;
+    if (!read_trace(paths[0], &entries)) {
+      fprintf(stderr, "%s is not a readable scanner trace\n", paths[0].c_str());
+      return 1;
+    }
+    print_entries(entries, slowest);
+    return 0;
+  }
+
+  TSParser *parser = ts_parser_new();
+  ts_parser_set_language(parser, tree_sitter_blade());
+  vector<TSBladeTraceEntry> entries(MAX_ENTRIES);
+  for (const SourceFile &file : load_files(paths)) {
+    tree_sitter_blade_scanner_trace_clear();
+    ts_tree_delete(ts_parser_parse_string(parser, NULL, file.contents.data(), file.contents.size()));
+    size_t length = tree_sitter_blade_scanner_trace(entries.data(), entries.size());
+    if (!length) {
+      fprintf(stderr, "no trace recorded; build the tools with `make TRACE=1`\n");
+      return 1;
+    }
+    printf("%s\n", file.path.c_str());
+    print_entries(vector<TSBladeTraceEntry>(entries.begin(), entries.begin() + length), slowest);
+    printf("\n");
+  }
+  ts_parser_delete(parser);
+  return 0;
+}